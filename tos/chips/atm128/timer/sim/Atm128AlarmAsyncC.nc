@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * The TOSSIM version of the 32-bit alarm and counter built on timer
+ * 0. By default this is the hardware Atm128AlarmAsyncP on top of the
+ * simulated timer 0, which takes a compare interrupt at least every
+ * MAXT counter ticks to extend the 8-bit counter, even when no alarm
+ * is set. Compiling with -DTOSSIM_TICKLESS_TIMERS uses
+ * SimAtm128AlarmAsyncP instead, which only schedules an event when
+ * an alarm actually expires.
+ *
+ * @date   Oct 18 2026
+ */
+
+generic configuration Atm128AlarmAsyncC(typedef precision, int divider) {
+  provides {
+    interface Init @atleastonce();
+    interface Alarm<precision, uint32_t>;
+    interface Counter<precision, uint32_t>;
+  }
+}
+implementation
+{
+#ifdef TOSSIM_TICKLESS_TIMERS
+  components new SimAtm128AlarmAsyncP(precision, divider);
+
+  Init = SimAtm128AlarmAsyncP;
+  Alarm = SimAtm128AlarmAsyncP;
+  Counter = SimAtm128AlarmAsyncP;
+#else
+  components new Atm128AlarmAsyncP(precision, divider),
+    HplAtm128Timer0AsyncC;
+
+  Init = Atm128AlarmAsyncP;
+  Alarm = Atm128AlarmAsyncP;
+  Counter = Atm128AlarmAsyncP;
+
+  Atm128AlarmAsyncP.Timer -> HplAtm128Timer0AsyncC;
+  Atm128AlarmAsyncP.TimerCtrl -> HplAtm128Timer0AsyncC;
+  Atm128AlarmAsyncP.Compare -> HplAtm128Timer0AsyncC;
+  Atm128AlarmAsyncP.TimerAsync -> HplAtm128Timer0AsyncC;
+#endif
+}
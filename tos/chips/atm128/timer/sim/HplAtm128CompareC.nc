@@ -276,8 +276,10 @@ implementation {
   void cancel_compare() {
     dbg("HplAtm128CompareC", "Cancelling compare at 0x%p\n", compare);
     if (compare != NULL) {
-      compare->cancelled = 1;
       compare->cleanup = sim_queue_cleanup_total;
+      // Frees the event if it is still queued.
+      sim_queue_cancel(compare);
+      compare = NULL;
     }
   }
 
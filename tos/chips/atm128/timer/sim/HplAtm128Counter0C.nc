@@ -326,8 +326,11 @@ implementation
 	dbg("HplAtm128Counter0C", "Setting overflow bit at %s\n", sim_time_string());
 	SET_BIT(ATM128_TIFR, TOV0);
       }
-      configure_overflow(evt);
-      sim_queue_insert(evt);
+      // If we haven't been cancelled
+      if (!evt->cancelled) {
+	configure_overflow(evt);
+	sim_queue_insert(evt);
+      }
     }
   }
   
@@ -378,9 +381,11 @@ implementation
   
   void cancel_overflow() {
     if (overflow != NULL) {
-      overflow->cancelled = 1;
       dbg("HplAtm128Counter0C", "Cancelling overflow %p.\n", overflow);
       overflow->cleanup = sim_queue_cleanup_total;
+      // Frees the event if it is still queued.
+      sim_queue_cancel(overflow);
+      overflow = NULL;
     }
   }
 }
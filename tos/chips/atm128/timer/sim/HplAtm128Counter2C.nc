@@ -324,8 +324,11 @@ implementation
 	dbg("HplAtm128Counter2C", "Setting overflow bit at %s\n", time);
 	SET_BIT(ATM128_TIFR, TOV2);
       }
-      configure_overflow(evt);
-      sim_queue_insert(evt);
+      // If we haven't been cancelled
+      if (!evt->cancelled) {
+	configure_overflow(evt);
+	sim_queue_insert(evt);
+      }
     }
   }
   
@@ -376,9 +379,11 @@ implementation
   
   void cancel_overflow() {
     if (overflow != NULL) {
-      overflow->cancelled = 1;
       dbg("HplAtm128Counter2C", "Cancelling overflow %p.\n", overflow);
       overflow->cleanup = sim_queue_cleanup_total;
+      // Frees the event if it is still queued.
+      sim_queue_cancel(overflow);
+      overflow = NULL;
     }
   }
 }
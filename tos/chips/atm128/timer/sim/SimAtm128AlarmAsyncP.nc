@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * A tickless TOSSIM implementation of the 32-bit alarm and counter
+ * that Atm128AlarmAsyncP builds from timer 0. The counter is derived
+ * from sim_time() when it is read, so there is no 8-bit counter to
+ * keep extending. A single event is scheduled, for when the alarm
+ * expires or the 32-bit counter next overflows, whichever is first.
+ * An idle mote therefore costs one event every 48 days rather than
+ * several per second.
+ *
+ * Like Atm128AlarmAsyncP, the counter starts at zero when Init is
+ * called and runs at ATM128_TIMER0_TICKSPPS scaled down by
+ * divider. An alarm fires when the counter reaches it rather than at
+ * the next timer 0 compare, so timing differs from the default
+ * implementation by up to a counter tick.
+ *
+ * Atm128AlarmAsyncC uses this component when TOSSIM is compiled with
+ * -DTOSSIM_TICKLESS_TIMERS.
+ *
+ * @date   Oct 18 2026
+ */
+
+#include <Atm128Timer.h>
+#include <hardware.h>
+
+generic module SimAtm128AlarmAsyncP(typedef precision, int divider) {
+  provides {
+    interface Init;
+    interface Alarm<precision, uint32_t>;
+    interface Counter<precision, uint32_t>;
+  }
+}
+implementation
+{
+  bool set;                    /* Is the alarm set? */
+  uint32_t t0, dt;             /* Time of the next alarm */
+  sim_time_t origin;           /* Sim time at which the counter was zero */
+  sim_time_t nextOverflow;     /* 64-bit count of the next unsignalled overflow */
+  sim_event_t* timerEvent = NULL;
+
+  void schedule_timer_event();
+
+  uint16_t shiftFromScale() {
+    switch (divider) {
+    case ATM128_CLK8_NORMAL:
+      return 0;
+    case ATM128_CLK8_DIVIDE_8:
+      return 3;
+    case ATM128_CLK8_DIVIDE_32:
+      return 5;
+    case ATM128_CLK8_DIVIDE_64:
+      return 6;
+    case ATM128_CLK8_DIVIDE_128:
+      return 7;
+    case ATM128_CLK8_DIVIDE_256:
+      return 8;
+    case ATM128_CLK8_DIVIDE_1024:
+      return 10;
+    default:
+      return 0;
+    }
+  }
+
+  sim_time_t counter_rate() {
+    return ATM128_TIMER0_TICKSPPS >> shiftFromScale();
+  }
+
+  /* The counter since Init, in 64 bits. The conversions split off
+     whole seconds so they cannot overflow in long simulations. */
+  sim_time_t current_count() {
+    sim_time_t elapsed = sim_time() - origin;
+    sim_time_t perSec = sim_ticks_per_sec();
+    return (elapsed / perSec) * counter_rate() + ((elapsed % perSec) * counter_rate()) / perSec;
+  }
+
+  /* The first sim time at which the counter reads count. */
+  sim_time_t count_to_sim(sim_time_t count) {
+    sim_time_t rate = counter_rate();
+    sim_time_t perSec = sim_ticks_per_sec();
+    return origin + (count / rate) * perSec + ((count % rate) * perSec + rate - 1) / rate;
+  }
+
+  void timer_event_handle(sim_event_t* evt) {
+    sim_time_t now;
+    bool overflowed = FALSE;
+    bool fired = FALSE;
+
+    if (evt != timerEvent) {
+      // Scheduled before the mote rebooted: nothing refers to it now.
+      evt->cleanup = sim_queue_cleanup_total;
+      return;
+    }
+
+    now = current_count();
+    dbg("SimAtm128AlarmAsyncP", "Timer event at %s, counter %llu\n", sim_time_string(), now);
+    atomic {
+      if (now >= nextOverflow) {
+	nextOverflow += 1LL << 32;
+	overflowed = TRUE;
+      }
+      if (set && (uint32_t)((uint32_t)now - t0) >= dt) {
+	set = FALSE;
+	fired = TRUE;
+      }
+      schedule_timer_event();
+    }
+    if (overflowed) {
+      signal Counter.overflow();
+    }
+    if (fired) {
+      signal Alarm.fired();
+    }
+  }
+
+  void schedule_timer_event() {
+    sim_time_t now = current_count();
+    sim_time_t next = nextOverflow;
+    sim_time_t when;
+
+    if (set) {
+      uint32_t elapsed = (uint32_t)now - t0;
+      sim_time_t expiry = now;
+      if (elapsed < dt) {
+	expiry += dt - elapsed;
+      }
+      if (expiry < next) {
+	next = expiry;
+      }
+    }
+
+    if (timerEvent == NULL) {
+      timerEvent = sim_queue_allocate_event();
+      timerEvent->mote = sim_node();
+      timerEvent->force = FALSE;
+      timerEvent->cancelled = FALSE;
+      timerEvent->handle = timer_event_handle;
+      timerEvent->cleanup = sim_queue_cleanup_none;
+    }
+    else {
+      sim_queue_remove(timerEvent);
+    }
+
+    when = count_to_sim(next);
+    if (when < sim_time()) {
+      when = sim_time();
+    }
+    timerEvent->time = when;
+    dbg("SimAtm128AlarmAsyncP", "Scheduling timer event for count %llu at %llu\n", next, when);
+    sim_queue_insert(timerEvent);
+  }
+
+  command error_t Init.init() {
+    atomic {
+      set = FALSE;
+      origin = sim_time();
+      nextOverflow = 1LL << 32;
+      schedule_timer_event();
+    }
+    return SUCCESS;
+  }
+
+  async command uint32_t Counter.get() {
+    return (uint32_t)current_count();
+  }
+
+  async command bool Counter.isOverflowPending() {
+    atomic return current_count() >= nextOverflow;
+  }
+
+  async command void Counter.clearOverflow() {
+    atomic {
+      if (current_count() >= nextOverflow) {
+	nextOverflow += 1LL << 32;
+	schedule_timer_event();
+      }
+    }
+  }
+
+  async command void Alarm.start(uint32_t ndt) {
+    call Alarm.startAt(call Counter.get(), ndt);
+  }
+
+  async command void Alarm.stop() {
+    atomic {
+      set = FALSE;
+      schedule_timer_event();
+    }
+  }
+
+  async command bool Alarm.isRunning() {
+    atomic return set;
+  }
+
+  async command void Alarm.startAt(uint32_t nt0, uint32_t ndt) {
+    atomic {
+      set = TRUE;
+      t0 = nt0;
+      dt = ndt;
+      schedule_timer_event();
+    }
+  }
+
+  async command uint32_t Alarm.getNow() {
+    return call Counter.get();
+  }
+
+  async command uint32_t Alarm.getAlarm() {
+    atomic return t0 + dt;
+  }
+}
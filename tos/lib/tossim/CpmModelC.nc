@@ -47,6 +47,8 @@
 
 #include <sim_gain.h>
 #include <sim_noise.h>
+#include <sim_dbm.h>
+#include <sim_prr.h>
 #include <randomlib.h>
 
 module CpmModelC {
@@ -68,15 +70,25 @@ implementation {
     sim_time_t start;
     sim_time_t end;
     double power;
+    double powerMw;      // power, in mW
     double reversePower;
     int8_t strength;
     bool lost;
     bool ack;
+    bool outstanding;    // Whether on the outstanding reception list
     message_t* msg;
     receive_message_t* next;
   };
 
   receive_message_t* outstandingReceptionHead = NULL;
+  // Sum of the powers of the outstanding receptions, in mW, so that
+  // computing the noise a packet sees (and so clear channel
+  // assessment) does not walk the outstanding list. A reception adds
+  // its power when it starts; when one ends the sum is recomputed
+  // during the walk that unlinks it, as subtracting a strong signal
+  // from the sum would leave rounding error comparable to the noise
+  // floor.
+  double interference = 0.0;
 
   receive_message_t* allocate_receive_message();
   void free_receive_message(receive_message_t* msg);
@@ -149,11 +161,7 @@ implementation {
   }
   
   double arr_estimate_from_snr(double SNR) {
-    double beta1 = 0.9794;
-    double beta2 = 2.3851;
-    double X = SNR-beta2;
-    double PSE = 0.5*erfc(beta1*X/sqrt(2));
-    double prr_hat = pow(1-PSE, 23*2);
+    double prr_hat = sim_prr_from_snr(SNR);
     dbg("CpmModelC,SNRLoss", "SNR is %lf, ARR is %lf\n", SNR, prr_hat);
     if (prr_hat > 1)
       prr_hat = 1.1;
@@ -214,7 +222,7 @@ implementation {
   }
 
   void sim_gain_schedule_ack(int source, sim_time_t t, receive_message_t* r) {
-    sim_event_t* ackEvent = (sim_event_t*)malloc(sizeof(sim_event_t));
+    sim_event_t* ackEvent = sim_queue_allocate_event();
     
     ackEvent->mote = source;
     ackEvent->force = 1;
@@ -228,14 +236,10 @@ implementation {
   }
 
   double prr_estimate_from_snr(double SNR) {
-    // Based on CC2420 measurement by Kannan.
-    // The updated function below fixes the problem of non-zero PRR
-    // at very low SNR. With this function PRR is 0 for SNR <= 3.
-    double beta1 = 0.9794;
-    double beta2 = 2.3851;
-    double X = SNR-beta2;
-    double PSE = 0.5*erfc(beta1*X/sqrt(2));
-    double prr_hat = pow(1-PSE, 23*2);
+    // Based on CC2420 measurement by Kannan, unless the script has
+    // set another curve; see sim_prr.h. The table replaces a call
+    // to erfc() and pow() per reception decision.
+    double prr_hat = sim_prr_from_snr(SNR);
     dbg("CpmModelC,SNR", "SNR is %lf, PRR is %lf\n", SNR, prr_hat);
     if (prr_hat > 1)
       prr_hat = 1.1;
@@ -258,31 +262,17 @@ implementation {
   }
 
   bool checkReceive(receive_message_t* msg) {
-    double noise = noise_hash_generation();
-    receive_message_t* list = outstandingReceptionHead;
-    noise = pow(10.0, noise / 10.0);
-    while (list != NULL) {
-      if (list != msg) {
-	noise += pow(10.0, list->power / 10.0);
-      }
-      list = list->next;
-    }
-    noise = 10.0 * log(noise) / log(10.0);
-    return shouldReceive(msg->power - noise);
+    return shouldReceive(msg->power - packetNoise(msg));
   }
-  
+
+  /* The noise a packet sees is the ambient noise plus the energy of
+     every other outstanding reception, summed in mW. */
   double packetNoise(receive_message_t* msg) {
-    double noise = noise_hash_generation();
-    receive_message_t* list = outstandingReceptionHead;
-    noise = pow(10.0, noise / 10.0);
-    while (list != NULL) {
-      if (list != msg) {
-	noise += pow(10.0, list->power / 10.0);
-      }
-      list = list->next;
+    double noise = sim_dbm_to_mw(noise_hash_generation()) + interference;
+    if (msg != NULL && msg->outstanding) {
+      noise -= msg->powerMw;
     }
-    noise = 10.0 * log(noise) / log(10.0);
-    return noise;
+    return sim_mw_to_dbm(noise);
   }
 
   double checkPrr(receive_message_t* msg) {
@@ -297,12 +287,16 @@ implementation {
     receive_message_t* mine = (receive_message_t*)evt->data;
     receive_message_t* predecessor = NULL;
     receive_message_t* list = outstandingReceptionHead;
+    double others = 0.0;
 
     dbg("CpmModelC", "Handling reception event @ %s.\n", sim_time_string());
     while (list != NULL) {
       if (list->next == mine) {
 	predecessor = list;
       }
+      if (list != mine) {
+	others += list->powerMw;
+      }
       list = list->next;
     }
     if (predecessor) {
@@ -314,6 +308,8 @@ implementation {
     else {
       dbgerror("CpmModelC", "Incoming packet list structure is corrupted: entry is not the head and no entry points to it.\n");
     }
+    mine->outstanding = FALSE;
+    interference = others;
     dbg("CpmModelC,SNRLoss", "Packet from %i to %i\n", (int)mine->source, (int)sim_node());
     if (!checkReceive(mine)) {
       dbg("CpmModelC,SNRLoss", " - lost packet from %i as SNR was too low.\n", (int)mine->source);
@@ -370,17 +366,20 @@ implementation {
     sim_event_t* evt;
     receive_message_t* list;
     receive_message_t* rcv = allocate_receive_message();
-    double noiseStr = packetNoise(rcv);
+    double noiseStr;
+    rcv->outstanding = FALSE;
+    noiseStr = packetNoise(rcv);
     rcv->source = source;
     rcv->start = sim_time();
     rcv->end = endTime;
     rcv->power = power;
+    rcv->powerMw = sim_dbm_to_mw(power);
     rcv->reversePower = reversePower;
     // The strength of a packet is the sum of the signal and noise. In most cases, this means
     // the signal. By sampling this here, it assumes that the packet RSSI is sampled at
     // the beginning of the packet. This is true for the CC2420, but is not true for all
     // radios. But generalizing seems like complexity for minimal gain at this point.
-    rcv->strength = (int8_t)(floor(10.0 * log(pow(10.0, power/10.0) + pow(10.0, noiseStr/10.0)) / log(10.0)));
+    rcv->strength = (int8_t)(floor(sim_mw_to_dbm(rcv->powerMw + sim_dbm_to_mw(noiseStr))));
     rcv->msg = msg;
     rcv->lost = 0;
     rcv->ack = receive;
@@ -420,6 +419,8 @@ implementation {
     
     rcv->next = outstandingReceptionHead;
     outstandingReceptionHead = rcv;
+    rcv->outstanding = TRUE;
+    interference += rcv->powerMw;
     evt = allocate_receive_event(endTime, rcv);
     sim_queue_insert(evt);
 
@@ -443,7 +444,7 @@ implementation {
 
     while (neighborEntry != NULL) {
       int other = neighborEntry->mote;
-      sim_gain_put(other, msg, endTime, ack, power + sim_gain_value(sim_node(), other), reversePower + sim_gain_value(other, sim_node()));
+      sim_gain_put(other, msg, endTime, ack, power + neighborEntry->gain, reversePower + neighborEntry->reverseGain);
       neighborEntry = sim_gain_next(neighborEntry);
     }
 
@@ -465,7 +466,7 @@ implementation {
  default event void Model.receive(message_t* msg) {}
 
  sim_event_t* allocate_receive_event(sim_time_t endTime, receive_message_t* msg) {
-   sim_event_t* evt = (sim_event_t*)malloc(sizeof(sim_event_t));
+   sim_event_t* evt = sim_queue_allocate_event();
    evt->mote = sim_node();
    evt->time = endTime;
    evt->handle = sim_gain_receive_handle;
@@ -477,10 +478,10 @@ implementation {
  }
 
  receive_message_t* allocate_receive_message() {
-   return (receive_message_t*)malloc(sizeof(receive_message_t));
+   return (receive_message_t*)sim_pool_alloc(sizeof(receive_message_t));
  }
 
  void free_receive_message(receive_message_t* msg) {
-   free(msg);
+   sim_pool_free(msg, sizeof(receive_message_t));
  }
 }
@@ -72,7 +72,9 @@ implementation {
   command void SimMote.turnOn() {
     if (!isOn) {
       if (bootEvent != NULL) {
-	bootEvent->cancelled = TRUE;
+	// Cancelling frees a queued event, so forget it.
+	sim_queue_cancel(bootEvent);
+	bootEvent = NULL;
       }
       __nesc_nido_initialise(sim_node());
       startTime = sim_time();
@@ -168,17 +170,11 @@ implementation {
     sim_set_node(mote);
 
     if (bootEvent != NULL)  {
-      if (bootEvent->time == startTime) {
-	// In case we have a cancelled boot event.
-	bootEvent->cancelled = FALSE;
-	return;
-      }
-      else {
-	bootEvent->cancelled = TRUE;
-      }
+      sim_queue_cancel(bootEvent);
+      bootEvent = NULL;
     }
     
-    bootEvent = (sim_event_t*) malloc(sizeof(sim_event_t));
+    bootEvent = sim_queue_allocate_event();
     bootEvent->time = startTime;
     bootEvent->mote = mote;
     bootEvent->force = TRUE;
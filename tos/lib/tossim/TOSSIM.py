@@ -104,7 +104,11 @@ class Radio(_object):
     def connected(*args): return _TOSSIM.Radio_connected(*args)
     def remove(*args): return _TOSSIM.Radio_remove(*args)
     def setNoise(*args): return _TOSSIM.Radio_setNoise(*args)
+    def setNoiseFloors(*args): return _TOSSIM.Radio_setNoiseFloors(*args)
     def setSensitivity(*args): return _TOSSIM.Radio_setSensitivity(*args)
+    def loadGainFile(*args): return _TOSSIM.Radio_loadGainFile(*args)
+    def addLinks(*args): return _TOSSIM.Radio_addLinks(*args)
+    def setPrrCurve(*args): return _TOSSIM.Radio_setPrrCurve(*args)
 Radio_swigregister = _TOSSIM.Radio_swigregister
 Radio_swigregister(Radio)
 
@@ -207,6 +211,56 @@ class Variable(_object):
 Variable_swigregister = _TOSSIM.Variable_swigregister
 Variable_swigregister(Variable)
 
+class Watch(_object):
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, Watch, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, Watch, name)
+    __repr__ = _swig_repr
+    def __init__(self, *args): 
+        this = _TOSSIM.new_Watch(*args)
+        try: self.this.append(this)
+        except: self.this = this
+    __swig_destroy__ = _TOSSIM.delete_Watch
+    __del__ = lambda self : None;
+    def valid(*args): return _TOSSIM.Watch_valid(*args)
+    def motes(*args): return _TOSSIM.Watch_motes(*args)
+    def size(*args): return _TOSSIM.Watch_size(*args)
+    def stride(*args): return _TOSSIM.Watch_stride(*args)
+    def type(*args): return _TOSSIM.Watch_type(*args)
+    def isArray(*args): return _TOSSIM.Watch_isArray(*args)
+    def getData(*args): return _TOSSIM.Watch_getData(*args)
+    def buffer(*args): return _TOSSIM.Watch_buffer(*args)
+    dtypes = {"uint8_t": "u1", "uint16_t": "u2", "uint32_t": "u4",
+              "uint64_t": "u8", "int8_t": "i1", "int16_t": "i2",
+              "int32_t": "i4", "int64_t": "i8", "char": "i1",
+              "unsigned char": "u1", "short": "h", "unsigned short": "H",
+              "int": "i", "unsigned int": "I", "long": "l",
+              "unsigned long": "L", "float": "f4", "double": "f8"}
+    def array(self):
+        """A numpy array over this variable on every mote, in place:
+        row i is mote i's value as the simulation runs, with no copy.
+        Arrays get a column per element and types numpy does not
+        know (structs) a column per byte. Take array().copy() for a
+        snapshot."""
+        view = self.__dict__.get("view")
+        if view is None:
+            import numpy
+            buf = self.buffer()
+            if buf is None:
+                raise KeyError("no such variable")
+            shape = (self.motes(),)
+            strides = (self.stride(),)
+            dtype = numpy.dtype(self.dtypes.get(self.type(), "u1"))
+            if self.isArray() or self.size() != dtype.itemsize:
+                shape += (self.size() // dtype.itemsize,)
+                strides += (dtype.itemsize,)
+            view = numpy.ndarray(shape, dtype, buf, 0, strides)
+            self.__dict__["view"] = view
+        return view
+Watch_swigregister = _TOSSIM.Watch_swigregister
+Watch_swigregister(Watch)
+
 class Mote(_object):
     __swig_setmethods__ = {}
     __setattr__ = lambda self, name, value: _swig_setattr(self, Mote, name, value)
@@ -231,6 +285,10 @@ class Mote(_object):
     def addNoiseTraceReading(*args): return _TOSSIM.Mote_addNoiseTraceReading(*args)
     def createNoiseModel(*args): return _TOSSIM.Mote_createNoiseModel(*args)
     def generateNoise(*args): return _TOSSIM.Mote_generateNoise(*args)
+    def saveNoiseModel(*args): return _TOSSIM.Mote_saveNoiseModel(*args)
+    def loadNoiseModel(*args): return _TOSSIM.Mote_loadNoiseModel(*args)
+    def loadNoiseTrace(*args): return _TOSSIM.Mote_loadNoiseTrace(*args)
+    def addNoiseTraceReadings(*args): return _TOSSIM.Mote_addNoiseTraceReadings(*args)
 Mote_swigregister = _TOSSIM.Mote_swigregister
 Mote_swigregister(Mote)
 
@@ -254,13 +312,159 @@ class Tossim(_object):
     def currentNode(*args): return _TOSSIM.Tossim_currentNode(*args)
     def getNode(*args): return _TOSSIM.Tossim_getNode(*args)
     def setCurrentNode(*args): return _TOSSIM.Tossim_setCurrentNode(*args)
+    def bootAtTimes(*args): return _TOSSIM.Tossim_bootAtTimes(*args)
     def addChannel(*args): return _TOSSIM.Tossim_addChannel(*args)
     def removeChannel(*args): return _TOSSIM.Tossim_removeChannel(*args)
     def randomSeed(*args): return _TOSSIM.Tossim_randomSeed(*args)
     def runNextEvent(*args): return _TOSSIM.Tossim_runNextEvent(*args)
+    def watch(*args): return _TOSSIM.Tossim_watch(*args)
     def mac(*args): return _TOSSIM.Tossim_mac(*args)
     def radio(*args): return _TOSSIM.Tossim_radio(*args)
     def newPacket(*args): return _TOSSIM.Tossim_newPacket(*args)
+    def queueSize(*args): return _TOSSIM.Tossim_queueSize(*args)
+    def queueRemovedCount(*args): return _TOSSIM.Tossim_queueRemovedCount(*args)
+    def queueTombstoneCount(*args): return _TOSSIM.Tossim_queueTombstoneCount(*args)
+    def poolAllocations(*args): return _TOSSIM.Tossim_poolAllocations(*args)
+    def poolInUse(*args): return _TOSSIM.Tossim_poolInUse(*args)
+    def poolPeakInUse(*args): return _TOSSIM.Tossim_poolPeakInUse(*args)
+    def poolSystemAllocations(*args): return _TOSSIM.Tossim_poolSystemAllocations(*args)
+    def poolReservedBytes(*args): return _TOSSIM.Tossim_poolReservedBytes(*args)
+    def runUntil(*args): return _TOSSIM.Tossim_runUntil(*args)
+    def runFor(*args): return _TOSSIM.Tossim_runFor(*args)
+    def runEvents(*args): return _TOSSIM.Tossim_runEvents(*args)
+    def setPace(*args): return _TOSSIM.Tossim_setPace(*args)
+    def paceSleeps(*args): return _TOSSIM.Tossim_paceSleeps(*args)
+    def paceSleepTime(*args): return _TOSSIM.Tossim_paceSleepTime(*args)
+    def paceLag(*args): return _TOSSIM.Tossim_paceLag(*args)
+    def paceMaxLag(*args): return _TOSSIM.Tossim_paceMaxLag(*args)
+    def setHook(self, hook, period):
+        """Call hook() each time runUntil() or runFor() has advanced
+        simulated time by period ticks. A hook of None removes it."""
+        if hook is not None and period <= 0:
+            raise ValueError("hook period must be positive")
+        self.__dict__["hook"] = hook
+        self.__dict__["hookPeriod"] = period
+        self.__dict__["hookTime"] = self.time() + period
+    def runUntil(self, time):
+        count = 0
+        while self.__dict__.get("hook") is not None and self.hookTime <= time:
+            count += _TOSSIM.Tossim_runUntil(self, self.hookTime)
+            self.__dict__["hookTime"] += self.hookPeriod
+            self.hook()
+        return count + _TOSSIM.Tossim_runUntil(self, time)
+    def runFor(self, ticks):
+        return self.runUntil(self.time() + ticks)
+    def mac(self):
+        m = self.__dict__.get("macModel")
+        if m is None:
+            m = self.__dict__["macModel"] = _TOSSIM.Tossim_mac(self)
+        return m
+    def radio(self):
+        r = self.__dict__.get("radioModel")
+        if r is None:
+            r = self.__dict__["radioModel"] = _TOSSIM.Tossim_radio(self)
+        return r
+    def stats(self):
+        """The event loop profile (see setProfiling()) as a dict:
+        totals, plus a "handlers" list with each event handler's
+        event count, time and cancellations, busiest first. Use
+        statsJson() to save it."""
+        import json
+        return json.loads(self.statsJson())
+    def branch(self, variants):
+        """Run each variant(tossim) in its own fork() of the simulation
+        as it stands now and wait for them all, so one warm-up can
+        feed many experiments. Returns each child's wait status, in
+        order; a variant that raises exits with status 1. Children
+        inherit the random number generator, so a variant should call
+        randomSeed() if the branches are meant to differ."""
+        import os, traceback
+        pids = []
+        for variant in variants:
+            pid = self.fork()
+            if pid < 0:
+                raise OSError("fork failed")
+            if pid == 0:
+                status = 0
+                try:
+                    variant(self)
+                except:
+                    traceback.print_exc()
+                    status = 1
+                self.endBranch(status)
+            pids.append(pid)
+        return [os.waitpid(pid, 0)[1] for pid in pids]
+    def ensemble(self, seeds, run, jobs=None, collect=None):
+        """Run run(tossim, seed) once per seed, each in its own fork()
+        of the simulation as it stands now after randomSeed(seed).
+        Load what the runs share (topology, noise traces and models)
+        and queue the boot events before calling this: the replicas
+        share that memory copy-on-write rather than each loading it.
+        At most jobs replicas (default: one per CPU) run at once.
+        Whatever run() returns is pickled back; collect(seed, result)
+        is called as each replica finishes. Returns the results in
+        seed order, with None for a replica that raised."""
+        import os, pickle, select, traceback
+        if jobs is None:
+            import multiprocessing
+            jobs = multiprocessing.cpu_count()
+        seeds = list(seeds)
+        results = [None] * len(seeds)
+        running = {}
+        chunks = {}
+        nextRun = 0
+        while nextRun < len(seeds) or running:
+            while nextRun < len(seeds) and len(running) < jobs:
+                r, w = os.pipe()
+                pid = self.fork()
+                if pid < 0:
+                    os.close(r)
+                    os.close(w)
+                    raise OSError("fork failed")
+                if pid == 0:
+                    os.close(r)
+                    for fd in running:
+                        os.close(fd)
+                    status = 0
+                    try:
+                        self.randomSeed(seeds[nextRun])
+                        data = pickle.dumps(run(self, seeds[nextRun]), 2)
+                        while data:
+                            data = data[os.write(w, data):]
+                    except:
+                        traceback.print_exc()
+                        status = 1
+                    os.close(w)
+                    self.endBranch(status)
+                os.close(w)
+                running[r] = (pid, nextRun)
+                chunks[r] = []
+                nextRun += 1
+            for fd in select.select(list(running), [], [])[0]:
+                chunk = os.read(fd, 65536)
+                if chunk:
+                    chunks[fd].append(chunk)
+                    continue
+                os.close(fd)
+                pid, index = running.pop(fd)
+                data = b"".join(chunks.pop(fd))
+                if os.waitpid(pid, 0)[1] == 0 and data:
+                    results[index] = pickle.loads(data)
+                if collect is not None:
+                    collect(seeds[index], results[index])
+        return results
+    def openTrace(*args): return _TOSSIM.Tossim_openTrace(*args)
+    def closeTrace(*args): return _TOSSIM.Tossim_closeTrace(*args)
+    def addTraceChannel(*args): return _TOSSIM.Tossim_addTraceChannel(*args)
+    def removeTraceChannel(*args): return _TOSSIM.Tossim_removeTraceChannel(*args)
+    def maxNodes(*args): return _TOSSIM.Tossim_maxNodes(*args)
+    def setMaxNodes(*args): return _TOSSIM.Tossim_setMaxNodes(*args)
+    def fork(*args): return _TOSSIM.Tossim_fork(*args)
+    def endBranch(*args): return _TOSSIM.Tossim_endBranch(*args)
+    def setProfiling(*args): return _TOSSIM.Tossim_setProfiling(*args)
+    def profiling(*args): return _TOSSIM.Tossim_profiling(*args)
+    def resetStats(*args): return _TOSSIM.Tossim_resetStats(*args)
+    def statsJson(*args): return _TOSSIM.Tossim_statsJson(*args)
 Tossim_swigregister = _TOSSIM.Tossim_swigregister
 Tossim_swigregister(Tossim)
 
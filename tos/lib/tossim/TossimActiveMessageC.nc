@@ -239,12 +239,15 @@ implementation {
    signal Model.receive(m);
  }
  
+ // The event owns msg: Packet::deliver() allocates it with
+ // sim_packet_copy() and sim_packet_deliver() takes ownership. It is
+ // freed once delivered or cancelled, as Model.receive copies it.
  sim_event_t* allocate_deliver_event(int node, message_t* msg, sim_time_t t) {
-   sim_event_t* evt = (sim_event_t*)malloc(sizeof(sim_event_t));
+   sim_event_t* evt = sim_queue_allocate_event();
    evt->mote = node;
    evt->time = t;
    evt->handle = active_message_deliver_handle;
-   evt->cleanup = sim_queue_cleanup_event;
+   evt->cleanup = sim_queue_cleanup_total;
    evt->cancelled = 0;
    evt->force = 0;
    evt->data = msg;
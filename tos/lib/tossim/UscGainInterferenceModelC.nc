@@ -127,7 +127,7 @@ implementation {
   }
 
   void sim_gain_schedule_ack(int source, sim_time_t t) {
-    sim_event_t* ackEvent = (sim_event_t*)malloc(sizeof(sim_event_t));
+    sim_event_t* ackEvent = sim_queue_allocate_event();
     ackEvent->mote = source;
     ackEvent->force = 1;
     ackEvent->cancelled = 0;
@@ -198,7 +198,7 @@ implementation {
       receiving = 0;
       dbg_clear("Gain", "  -packet was lost.\n");
     }
-    free(mine);
+    sim_pool_free(mine, sizeof(receive_message_t));
   }
   
   
@@ -280,7 +280,7 @@ implementation {
  default event void Model.receive(message_t* msg) {}
 
  sim_event_t* allocate_receive_event(sim_time_t endTime, receive_message_t* msg) {
-   sim_event_t* evt = (sim_event_t*)malloc(sizeof(sim_event_t));
+   sim_event_t* evt = sim_queue_allocate_event();
    evt->mote = sim_node();
    evt->time = endTime;
    evt->handle = sim_gain_receive_handle;
@@ -292,7 +292,7 @@ implementation {
  }
 
  receive_message_t* allocate_receive_message() {
-   return (receive_message_t*)malloc(sizeof(receive_message_t));
+   return (receive_message_t*)sim_pool_alloc(sizeof(receive_message_t));
  }
  
 }
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Accuracy check and microbenchmark for the way CpmModelC computes
+ * the noise a packet sees. It compares the old computation, which
+ * walked the list of outstanding receptions and called pow() on each
+ * one, against the mW sum CpmModelC now keeps, over a random
+ * sequence of receptions starting and ending, and checks that
+ * sim_dbm_to_mw() returns exactly what pow() does.
+ *
+ * @date   Oct 18 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/time.h>
+
+#include <sim_dbm.h>
+
+// Largest acceptable difference between the two computations, in dB.
+#define MAX_ERROR_DB 1e-9
+
+typedef struct reception {
+  double power;
+  double powerMw;
+} reception_t;
+
+static double now_seconds() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + (tv.tv_usec / 1000000.0);
+}
+
+static double uniform(double low, double high) {
+  return low + (high - low) * (random() / (RAND_MAX + 1.0));
+}
+
+static double walk_noise(double noise, reception_t* list, int count) {
+  int i;
+  noise = pow(10.0, noise / 10.0);
+  for (i = 0; i < count; i++) {
+    noise += pow(10.0, list[i].power / 10.0);
+  }
+  return 10.0 * log(noise) / log(10.0);
+}
+
+static double sum_noise(double noise, double interference) {
+  return sim_mw_to_dbm(sim_dbm_to_mw(noise) + interference);
+}
+
+static int check_table() {
+  int i, errors = 0;
+  for (i = SIM_DBM_TABLE_MIN - 10; i <= SIM_DBM_TABLE_MAX + 10; i++) {
+    double x = i;
+    if (sim_dbm_to_mw(x) != pow(10.0, x / 10.0) ||
+	sim_dbm_to_mw(x + 0.25) != pow(10.0, (x + 0.25) / 10.0)) {
+      printf("ERROR: sim_dbm_to_mw(%i) differs from pow().\n", i);
+      errors++;
+    }
+  }
+  return errors;
+}
+
+static void usage(const char* name) {
+  fprintf(stderr, "usage: %s [-m max outstanding] [-n steps]\n", name);
+  exit(1);
+}
+
+int main(int argc, char** argv) {
+  int maxOutstanding = 64;
+  int steps = 1000000;
+  int count = 0;
+  int i;
+  reception_t* list;
+  double interference = 0.0;
+  double maxError = 0.0;
+  double walkTime, sumTime, start, checksum = 0.0;
+
+  for (i = 1; i < argc; i++) {
+    if (i + 1 >= argc) {
+      usage(argv[0]);
+    }
+    if (strcmp(argv[i], "-m") == 0) {maxOutstanding = atoi(argv[++i]);}
+    else if (strcmp(argv[i], "-n") == 0) {steps = atoi(argv[++i]);}
+    else {usage(argv[0]);}
+  }
+  if (maxOutstanding < 1) {
+    usage(argv[0]);
+  }
+  if (check_table()) {
+    return 1;
+  }
+
+  srandom(1);
+  list = (reception_t*)malloc(sizeof(reception_t) * maxOutstanding);
+  for (i = 0; i < steps; i++) {
+    // Noise traces hold integral dBm values
+    double noise = floor(uniform(-105.0, -60.0));
+    double error;
+    if (count < maxOutstanding && (count == 0 || random() % 2)) {
+      list[count].power = uniform(-110.0, 0.0);
+      list[count].powerMw = sim_dbm_to_mw(list[count].power);
+      interference += list[count].powerMw;
+      count++;
+    }
+    else {
+      // As in CpmModelC, a reception ending recomputes the sum.
+      int victim = random() % count;
+      int j;
+      list[victim] = list[--count];
+      interference = 0.0;
+      for (j = 0; j < count; j++) {
+	interference += list[j].powerMw;
+      }
+    }
+    error = fabs(walk_noise(noise, list, count) - sum_noise(noise, interference));
+    if (error > maxError) {
+      maxError = error;
+    }
+  }
+  printf("Maximum error over %i steps: %g dB\n", steps, maxError);
+
+  // Time clear channel assessment with the list full.
+  count = maxOutstanding;
+  interference = 0.0;
+  for (i = 0; i < count; i++) {
+    list[i].power = uniform(-110.0, -20.0);
+    list[i].powerMw = sim_dbm_to_mw(list[i].power);
+    interference += list[i].powerMw;
+  }
+  start = now_seconds();
+  for (i = 0; i < steps; i++) {
+    checksum += walk_noise(-98.0 + (i & 15), list, count);
+  }
+  walkTime = now_seconds() - start;
+  start = now_seconds();
+  for (i = 0; i < steps; i++) {
+    checksum -= sum_noise(-98.0 + (i & 15), interference);
+  }
+  sumTime = now_seconds() - start;
+  printf("%i outstanding: list walk %8.1f ns/sample, running sum %8.1f ns/sample\n",
+	 count, (walkTime * 1e9) / steps, (sumTime * 1e9) / steps);
+  if (fabs(checksum) > steps * MAX_ERROR_DB) {
+    printf("ERROR: timed computations disagree.\n");
+    return 1;
+  }
+
+  if (maxError > MAX_ERROR_DB) {
+    printf("ERROR: running sum differs from the list walk by more than %g dB.\n", MAX_ERROR_DB);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Checks and times hashtable.c on the two kinds of key TOSSIM
+ * uses it, or has used it, for:
+ *
+ *   channels   debug channel names, as sim_log.c looks them up on
+ *              every dbg() call, with trace channels added and
+ *              removed along the way
+ *   histories  NOISE_HISTORY-byte noise histories, built from a
+ *              noise trace and then looked up along a walk through
+ *              it, as the noise model did before it got a table of
+ *              its own
+ *
+ * Every lookup is checked against the value inserted.
+ *
+ * @date   Oct 18 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include <hashtable.h>
+
+enum {
+  HISTORY = 20, // NOISE_HISTORY in sim_noise.h
+};
+
+static int errors = 0;
+
+static double now_seconds() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + (tv.tv_usec / 1000000.0);
+}
+
+/* sdbm, as sim_log.c and tossim.c use. */
+static unsigned int string_hash(void* key) {
+  char* str = (char*)key;
+  unsigned int hashVal = 0;
+  int c;
+  while ((c = *str++))
+    hashVal = c + (hashVal << 6) + (hashVal << 16) - hashVal;
+  return hashVal;
+}
+
+static int string_eq(void* key1, void* key2) {
+  return strcmp((char*)key1, (char*)key2) == 0;
+}
+
+static unsigned int history_hash(void* key) {
+  unsigned char* pt = (unsigned char*)key;
+  unsigned int hashVal = 0;
+  int i;
+  for (i = 0; i < HISTORY; i++)
+    hashVal = pt[i] + (hashVal << 6) + (hashVal << 16) - hashVal;
+  return hashVal;
+}
+
+static int history_eq(void* key1, void* key2) {
+  return memcmp(key1, key2, HISTORY) == 0;
+}
+
+static void check(void* found, void* expected, const char* what) {
+  if (found != expected) {
+    if (errors++ < 10) {
+      printf("ERROR: %s lookup returned %p, expected %p.\n", what, found, expected);
+    }
+  }
+}
+
+static void bench_channels(int channels, int lookups) {
+  struct hashtable* h = create_hashtable(128, string_hash, string_eq);
+  char** names = (char**)malloc(sizeof(char*) * channels);
+  char miss[64];
+  double start, insertTime, lookupTime, churnTime;
+  int i;
+
+  for (i = 0; i < channels; i++) {
+    names[i] = (char*)malloc(32);
+    snprintf(names[i], 32, "Module%iC,Channel%i", i / 4, i % 4);
+  }
+  start = now_seconds();
+  for (i = 0; i < channels; i++) {
+    hashtable_insert(h, strdup(names[i]), names[i]);
+  }
+  insertTime = now_seconds() - start;
+
+  start = now_seconds();
+  for (i = 0; i < lookups; i++) {
+    int which = (int)(((long long)i * 7919) % channels);
+    check(hashtable_search(h, names[which]), names[which], "channel");
+  }
+  lookupTime = now_seconds() - start;
+
+  // Trace channels come and go; half the lookups miss.
+  start = now_seconds();
+  for (i = 0; i < lookups / 10; i++) {
+    snprintf(miss, sizeof(miss), "Trace%i", i % 64);
+    if (i % 2 == 0) {
+      check(hashtable_search(h, miss), NULL, "missing channel");
+      hashtable_insert(h, strdup(miss), names[0]);
+    }
+    else {
+      snprintf(miss, sizeof(miss), "Trace%i", (i - 1) % 64);
+      check(hashtable_remove(h, miss), names[0], "removed channel");
+    }
+  }
+  churnTime = now_seconds() - start;
+  if (hashtable_count(h) != (unsigned int)channels) {
+    printf("ERROR: %u channels left, expected %i.\n", hashtable_count(h), channels);
+    errors++;
+  }
+  for (i = 0; i < channels; i++) {
+    check(hashtable_search(h, names[i]), names[i], "channel after churn");
+  }
+  printf("channels:  %i keys, insert %6.1f ns, lookup %6.1f ns, insert/remove %6.1f ns\n",
+	 channels, insertTime * 1e9 / channels, lookupTime * 1e9 / lookups,
+	 churnTime * 1e9 / (lookups / 10));
+  hashtable_destroy(h, 0);
+  for (i = 0; i < channels; i++) {
+    free(names[i]);
+  }
+  free(names);
+}
+
+static char* read_trace(const char* path, int* len) {
+  FILE* file = fopen(path, "r");
+  int size = 1024;
+  char* trace = (char*)malloc(size);
+  int val;
+  *len = 0;
+  if (file == NULL) {
+    perror(path);
+    exit(1);
+  }
+  while (fscanf(file, "%i", &val) == 1) {
+    if (*len == size) {
+      size *= 2;
+      trace = (char*)realloc(trace, size);
+    }
+    trace[(*len)++] = (char)val;
+  }
+  fclose(file);
+  return trace;
+}
+
+static char* random_trace(int len) {
+  char* trace = (char*)malloc(len);
+  int i, val = -98;
+  srandom(1);
+  for (i = 0; i < len; i++) {
+    val += (int)(random() % 5) - 2;
+    if (val < -105) {val = -105;}
+    if (val > -60) {val = -60;}
+    trace[i] = (char)val;
+  }
+  return trace;
+}
+
+static void bench_histories(char* trace, int len, int lookups) {
+  struct hashtable* h = create_hashtable(128, history_hash, history_eq);
+  int* counts;
+  int i, distinct = 0;
+  double start, buildTime, lookupTime;
+
+  if (len <= HISTORY) {
+    printf("ERROR: trace shorter than a history.\n");
+    errors++;
+    return;
+  }
+  counts = (int*)calloc(len, sizeof(int));
+  // Values are the index of the first occurrence, plus one.
+  start = now_seconds();
+  for (i = 0; i + HISTORY <= len; i++) {
+    long first = (long)hashtable_search(h, trace + i);
+    if (first == 0) {
+      char* key = (char*)malloc(HISTORY);
+      memcpy(key, trace + i, HISTORY);
+      hashtable_insert(h, key, (void*)(long)(i + 1));
+      distinct++;
+      first = i + 1;
+    }
+    counts[first - 1]++;
+  }
+  buildTime = now_seconds() - start;
+
+  start = now_seconds();
+  for (i = 0; i < lookups; i++) {
+    int pos = (int)(((long long)i * 104729) % (len - HISTORY + 1));
+    long first = (long)hashtable_search(h, trace + pos);
+    if (first == 0 || memcmp(trace + first - 1, trace + pos, HISTORY) != 0) {
+      if (errors++ < 10) {
+	printf("ERROR: history at %i not found.\n", pos);
+      }
+    }
+  }
+  lookupTime = now_seconds() - start;
+  if (hashtable_count(h) != (unsigned int)distinct) {
+    printf("ERROR: %u histories, expected %i.\n", hashtable_count(h), distinct);
+    errors++;
+  }
+  printf("histories: %i readings, %i distinct, build %6.1f ns/reading, lookup %6.1f ns\n",
+	 len, distinct, buildTime * 1e9 / (len - HISTORY + 1), lookupTime * 1e9 / lookups);
+  hashtable_destroy(h, 0);
+  free(counts);
+}
+
+static void usage(const char* name) {
+  fprintf(stderr, "usage: %s [-f noise trace] [-c channels] [-n lookups]\n", name);
+  exit(1);
+}
+
+int main(int argc, char** argv) {
+  const char* path = NULL;
+  int channels = 300;
+  int lookups = 5000000;
+  char* trace;
+  int len, i;
+
+  for (i = 1; i < argc; i++) {
+    if (i + 1 >= argc) {
+      usage(argv[0]);
+    }
+    if (strcmp(argv[i], "-f") == 0) {path = argv[++i];}
+    else if (strcmp(argv[i], "-c") == 0) {channels = atoi(argv[++i]);}
+    else if (strcmp(argv[i], "-n") == 0) {lookups = atoi(argv[++i]);}
+    else {usage(argv[0]);}
+  }
+  if (channels < 1 || lookups < 10) {
+    usage(argv[0]);
+  }
+
+  bench_channels(channels, lookups);
+  if (path != NULL) {
+    trace = read_trace(path, &len);
+  }
+  else {
+    len = 100000;
+    trace = random_trace(len);
+  }
+  bench_histories(trace, len, lookups);
+  free(trace);
+  return (errors == 0)? 0 : 1;
+}
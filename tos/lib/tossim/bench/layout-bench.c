@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Microbenchmark for the memory layout of nido-replicated module
+ * variables. Under -fnesc-simulate, nesC turns every module variable
+ * into an array with one entry per possible node, so a handler that
+ * touches k variables of one mote touches k cache lines that are
+ * TOSSIM_MAX_NODES entries apart. This models that layout and
+ * compares it against a hypothetical one that keeps each mote's
+ * variables in one contiguous block:
+ *
+ *   nido-call   per-variable arrays, indexed by calling sim_node()
+ *               (-fnesc-nido-motenumber=sim_node())
+ *   nido-var    per-variable arrays, indexed by a global
+ *               (-fnesc-nido-motenumber=sim_current_node)
+ *   block       one block per mote, reached through a base pointer
+ *
+ * Each event picks a random active node and one of a fixed set of
+ * handlers. A handler reads and writes a fixed set of variables,
+ * drawn in runs of four adjacent ones, as a handler calling through
+ * a few components would. The block layout would need nesC to emit a per-node
+ * struct; it is here to show what that would buy.
+ *
+ * @date   Oct 18 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <sys/time.h>
+
+enum {
+  HANDLERS = 32,
+  MODULE_VARS = 4,
+};
+
+static unsigned long current_node;
+
+// Not inlined, like sim_node() in a -O0 TOSSIM build, or when the
+// application and sim_tossim.c end up in different objects.
+static unsigned long __attribute__((noinline)) bench_node() {
+  return current_node;
+}
+
+static double now_seconds() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + (tv.tv_usec / 1000000.0);
+}
+
+static uint32_t run_nido_call(uint32_t* data, int maxNodes, const int* nodes, const int* handlers,
+			      int events, int** touched, int perHandler) {
+  uint32_t sum = 0;
+  int i, j;
+  for (i = 0; i < events; i++) {
+    const int* vars = touched[handlers[i]];
+    current_node = nodes[i];
+    for (j = 0; j < perHandler; j++) {
+      uint32_t* v = &data[(size_t)vars[j] * maxNodes + bench_node()];
+      *v = *v * 3 + 1;
+      sum += *v;
+    }
+  }
+  return sum;
+}
+
+static uint32_t run_nido_var(uint32_t* data, int maxNodes, const int* nodes, const int* handlers,
+			     int events, int** touched, int perHandler) {
+  uint32_t sum = 0;
+  int i, j;
+  for (i = 0; i < events; i++) {
+    const int* vars = touched[handlers[i]];
+    current_node = nodes[i];
+    for (j = 0; j < perHandler; j++) {
+      uint32_t* v = &data[(size_t)vars[j] * maxNodes + current_node];
+      *v = *v * 3 + 1;
+      sum += *v;
+    }
+  }
+  return sum;
+}
+
+static uint32_t run_block(uint32_t* data, int numVars, const int* nodes, const int* handlers,
+			  int events, int** touched, int perHandler) {
+  uint32_t sum = 0;
+  int i, j;
+  for (i = 0; i < events; i++) {
+    const int* vars = touched[handlers[i]];
+    uint32_t* base = &data[(size_t)nodes[i] * numVars];
+    for (j = 0; j < perHandler; j++) {
+      uint32_t* v = &base[vars[j]];
+      *v = *v * 3 + 1;
+      sum += *v;
+    }
+  }
+  return sum;
+}
+
+static void usage(const char* name) {
+  fprintf(stderr, "usage: %s [-m max nodes] [-a active nodes] [-v variables] [-k variables per handler] [-n events]\n", name);
+  exit(1);
+}
+
+int main(int argc, char** argv) {
+  int maxNodes = 1000;
+  int active = 100;
+  int numVars = 400;
+  int perHandler = 12;
+  int events = 10000000;
+  int* nodes;
+  int* handlers;
+  int* touched[HANDLERS];
+  uint32_t* data;
+  uint32_t sums[3] = {0, 0, 0};
+  const char* names[3] = {"nido-call", "nido-var", "block"};
+  size_t bytes;
+  int i, j, start = 0;
+
+  for (i = 1; i < argc; i++) {
+    if (i + 1 >= argc) {
+      usage(argv[0]);
+    }
+    if (strcmp(argv[i], "-m") == 0) {maxNodes = atoi(argv[++i]);}
+    else if (strcmp(argv[i], "-a") == 0) {active = atoi(argv[++i]);}
+    else if (strcmp(argv[i], "-v") == 0) {numVars = atoi(argv[++i]);}
+    else if (strcmp(argv[i], "-k") == 0) {perHandler = atoi(argv[++i]);}
+    else if (strcmp(argv[i], "-n") == 0) {events = atoi(argv[++i]);}
+    else {usage(argv[0]);}
+  }
+  if (active < 1 || active > maxNodes || numVars < 1 || perHandler < 1 || perHandler > numVars || numVars < MODULE_VARS) {
+    usage(argv[0]);
+  }
+
+  srandom(1);
+  for (i = 0; i < HANDLERS; i++) {
+    touched[i] = (int*)malloc(sizeof(int) * perHandler);
+    // Handlers run through a few components, each of which touches
+    // a few variables it declares next to each other.
+    for (j = 0; j < perHandler; j++) {
+      if (j % MODULE_VARS == 0) {
+	start = random() % (numVars - MODULE_VARS + 1);
+      }
+      touched[i][j] = start + (j % MODULE_VARS);
+    }
+  }
+  nodes = (int*)malloc(sizeof(int) * events);
+  handlers = (int*)malloc(sizeof(int) * events);
+  for (i = 0; i < events; i++) {
+    nodes[i] = random() % active;
+    handlers[i] = random() % HANDLERS;
+  }
+
+  bytes = sizeof(uint32_t) * (size_t)maxNodes * numVars;
+  data = (uint32_t*)malloc(bytes);
+  printf("%i variables x %i nodes (%.1f MB), %i active, %i variables per event, %i events.\n",
+	 numVars, maxNodes, bytes / 1048576.0, active, perHandler, events);
+
+  for (i = 0; i < 3; i++) {
+    double start, elapsed;
+    memset(data, 0, bytes);
+    start = now_seconds();
+    switch (i) {
+    case 0: sums[i] = run_nido_call(data, maxNodes, nodes, handlers, events, touched, perHandler); break;
+    case 1: sums[i] = run_nido_var(data, maxNodes, nodes, handlers, events, touched, perHandler); break;
+    default: sums[i] = run_block(data, numVars, nodes, handlers, events, touched, perHandler); break;
+    }
+    elapsed = now_seconds() - start;
+    printf("%-10s %8.3f s  %8.1f ns/event\n", names[i], elapsed, (elapsed * 1e9) / events);
+  }
+  if (sums[0] != sums[1] || sums[0] != sums[2]) {
+    printf("ERROR: layouts computed different results.\n");
+    return 1;
+  }
+  return 0;
+}
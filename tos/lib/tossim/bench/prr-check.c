@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Accuracy check and microbenchmark for the PRR/SNR table CpmModelC
+ * uses. It sweeps SNR across and beyond the table's range, compares
+ * sim_prr_from_snr() against the erfc()/pow() curve it was built
+ * from, for the default curve and for a steeper one set with
+ * sim_prr_set_curve(), and times both.
+ *
+ * @date   Oct 18 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/time.h>
+
+// sim_prr.c marks sim_prr_set_curve() for nesC with an attribute
+// after the declarator, which gcc rejects in a definition.
+#define __attribute__(x)
+#include <sim_prr.c>
+#undef __attribute__
+
+// Largest acceptable difference between the table and the curve.
+#define MAX_ERROR 1e-4
+
+static double now_seconds() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + (tv.tv_usec / 1000000.0);
+}
+
+// The table clamps outside its range; so does the check.
+static double expected(double snr) {
+  if (snr < SIM_PRR_SNR_MIN) {snr = SIM_PRR_SNR_MIN;}
+  if (snr > SIM_PRR_SNR_MAX) {snr = SIM_PRR_SNR_MAX;}
+  return sim_prr_analytic(snr);
+}
+
+static double sweep(double step) {
+  double snr, maxError = 0.0;
+  for (snr = SIM_PRR_SNR_MIN - 5.0; snr <= SIM_PRR_SNR_MAX + 5.0; snr += step) {
+    double error = fabs(sim_prr_from_snr(snr) - expected(snr));
+    if (error > maxError) {
+      maxError = error;
+    }
+  }
+  return maxError;
+}
+
+static void usage(const char* name) {
+  fprintf(stderr, "usage: %s [-s sweep step in dB] [-n steps]\n", name);
+  exit(1);
+}
+
+int main(int argc, char** argv) {
+  double step = 0.001;
+  int steps = 10000000;
+  int i, errors = 0;
+  double error, start, analyticTime, tableTime, checksum = 0.0;
+  double* snrs;
+
+  for (i = 1; i < argc; i++) {
+    if (i + 1 >= argc) {
+      usage(argv[0]);
+    }
+    if (strcmp(argv[i], "-s") == 0) {step = atof(argv[++i]);}
+    else if (strcmp(argv[i], "-n") == 0) {steps = atoi(argv[++i]);}
+    else {usage(argv[0]);}
+  }
+  if (step <= 0.0 || steps < 1) {
+    usage(argv[0]);
+  }
+
+  error = sweep(step);
+  printf("Default curve: maximum error %g\n", error);
+  if (error > MAX_ERROR) {errors++;}
+
+  sim_prr_set_curve(1.8, 1.0, 2 * 128);
+  error = sweep(step);
+  printf("Steep curve:   maximum error %g\n", error);
+  if (error > MAX_ERROR) {errors++;}
+
+  sim_prr_set_curve(0.9794, 2.3851, 23 * 2);
+  if (sim_prr_from_snr(SIM_PRR_SNR_MAX + 100.0) != sim_prr_from_snr(SIM_PRR_SNR_MAX) ||
+      sim_prr_from_snr(SIM_PRR_SNR_MIN - 100.0) != sim_prr_from_snr(SIM_PRR_SNR_MIN) ||
+      sim_prr_from_snr(NAN) != sim_prr_from_snr(SIM_PRR_SNR_MIN)) {
+    printf("ERROR: table does not clamp outside its range.\n");
+    errors++;
+  }
+
+  // SNRs as CpmModelC sees them: mostly inside the interesting part
+  // of the curve.
+  srandom(1);
+  snrs = (double*)malloc(sizeof(double) * 4096);
+  for (i = 0; i < 4096; i++) {
+    snrs[i] = -5.0 + 20.0 * (random() / (RAND_MAX + 1.0));
+  }
+  start = now_seconds();
+  for (i = 0; i < steps; i++) {
+    checksum += sim_prr_analytic(snrs[i & 4095]);
+  }
+  analyticTime = now_seconds() - start;
+  start = now_seconds();
+  for (i = 0; i < steps; i++) {
+    checksum -= sim_prr_from_snr(snrs[i & 4095]);
+  }
+  tableTime = now_seconds() - start;
+  printf("erfc/pow %8.1f ns/sample, table %8.1f ns/sample\n",
+	 (analyticTime * 1e9) / steps, (tableTime * 1e9) / steps);
+  if (fabs(checksum) > steps * MAX_ERROR) {
+    printf("ERROR: timed computations disagree.\n");
+    errors++;
+  }
+
+  if (errors) {
+    printf("ERROR: table differs from the curve by more than %g.\n", MAX_ERROR);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Microbenchmark for the TOSSIM event queue backends. Runs the same
+ * operation sequence against the binary heap (heap.c) and the
+ * calendar queue (calendar.c) and reports the time per operation.
+ *
+ * The sequence is either a "hold" model over a synthetic distribution
+ * of event time increments, or a trace recorded from a real
+ * simulation. To record a trace, compile the application with
+ * -DTOSSIM_QUEUE_TRACE (and not with sim-fast) and in Python:
+ *
+ *   t.addChannel("QueueTrace", open("queue.trace", "w"))
+ *
+ * Each line of the trace is either "i <delta>" (an event inserted
+ * delta ticks after the current time) or "p" (a pop).
+ *
+ * @date   Oct 18 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/time.h>
+
+#include <heap.h>
+#include <calendar.h>
+
+typedef enum {
+  OP_INSERT = 0,
+  OP_POP = 1,
+} op_type_t;
+
+typedef struct op {
+  op_type_t type;
+  long long int delta;
+} op_t;
+
+typedef struct queue_ops {
+  const char* name;
+  void* queue;
+  void (*insert)(void* q, void* data, long long int key);
+  void* (*pop)(void* q, long long int* key);
+  int (*is_empty)(void* q);
+} queue_ops_t;
+
+static void q_heap_insert(void* q, void* data, long long int key) {heap_insert((heap_t*)q, data, key);}
+static void* q_heap_pop(void* q, long long int* key) {return heap_pop_min_data((heap_t*)q, key);}
+static int q_heap_is_empty(void* q) {return heap_is_empty((heap_t*)q);}
+static void q_cal_insert(void* q, void* data, long long int key) {calendar_insert((calendar_t*)q, data, key);}
+static void* q_cal_pop(void* q, long long int* key) {return calendar_pop_min_data((calendar_t*)q, key);}
+static int q_cal_is_empty(void* q) {return calendar_is_empty((calendar_t*)q);}
+
+static double now_seconds() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + (tv.tv_usec / 1000000.0);
+}
+
+// Time increments, in 10 GHz TOSSIM ticks.
+static long long int sample_delta(const char* dist) {
+  double u = (random() + 1.0) / (RAND_MAX + 2.0);
+  if (strcmp(dist, "exp") == 0) {          // Mean 10ms
+    return (long long int)(-log(u) * 100000000.0);
+  }
+  else if (strcmp(dist, "uniform") == 0) { // 0-20ms
+    return (long long int)(u * 200000000.0);
+  }
+  else if (strcmp(dist, "bimodal") == 0) { // CSMA backoffs and 1s timers
+    if (random() % 10 < 9) {
+      return (long long int)(u * 1500000.0);
+    }
+    return 10000000000LL + (long long int)(u * 1000000.0);
+  }
+  else if (strcmp(dist, "ties") == 0) {    // Many events on the same tick
+    return (random() % 4) * 100000000LL;
+  }
+  fprintf(stderr, "Unknown distribution %s.\n", dist);
+  exit(1);
+}
+
+static op_t* make_hold_ops(const char* dist, int pending, int holds, int* count) {
+  op_t* ops = (op_t*)malloc(sizeof(op_t) * (pending + 2 * holds));
+  int i, n = 0;
+  for (i = 0; i < pending; i++) {
+    ops[n].type = OP_INSERT;
+    ops[n++].delta = sample_delta(dist);
+  }
+  for (i = 0; i < holds; i++) {
+    ops[n++].type = OP_POP;
+    ops[n].type = OP_INSERT;
+    ops[n++].delta = sample_delta(dist);
+  }
+  *count = n;
+  return ops;
+}
+
+static op_t* read_trace_ops(const char* path, int* count) {
+  FILE* file = fopen(path, "r");
+  char line[128];
+  int size = 1024;
+  int n = 0;
+  op_t* ops;
+  
+  if (file == NULL) {
+    perror(path);
+    exit(1);
+  }
+  ops = (op_t*)malloc(sizeof(op_t) * size);
+  while (fgets(line, sizeof(line), file) != NULL) {
+    if (n == size) {
+      size *= 2;
+      ops = (op_t*)realloc(ops, sizeof(op_t) * size);
+    }
+    if (line[0] == 'i') {
+      ops[n].type = OP_INSERT;
+      ops[n++].delta = strtoll(line + 1, NULL, 10);
+    }
+    else if (line[0] == 'p') {
+      ops[n++].type = OP_POP;
+    }
+  }
+  fclose(file);
+  *count = n;
+  return ops;
+}
+
+// Replays the operations; returns a checksum of the popped keys and
+// data so the backends can be checked against each other. Each entry's
+// data is the index of the operation that inserted it, so this also
+// checks that both backends break ties between equal keys the same way.
+static unsigned long long run(queue_ops_t* q, op_t* ops, int count, double* elapsed) {
+  long long int now = 0;
+  unsigned long long checksum = 0;
+  double start = now_seconds();
+  int i;
+
+  for (i = 0; i < count; i++) {
+    if (ops[i].type == OP_INSERT) {
+      q->insert(q->queue, (void*)(long)i, now + ops[i].delta);
+    }
+    else if (!q->is_empty(q->queue)) {
+      long data = (long)q->pop(q->queue, &now);
+      checksum = (checksum * 31) + now;
+      checksum = (checksum * 31) + data;
+    }
+  }
+  while (!q->is_empty(q->queue)) {
+    long data = (long)q->pop(q->queue, &now);
+    checksum = (checksum * 31) + now;
+    checksum = (checksum * 31) + data;
+  }
+  *elapsed = now_seconds() - start;
+  return checksum;
+}
+
+static void usage(const char* name) {
+  fprintf(stderr, "usage: %s [-d exp|uniform|bimodal|ties] [-q pending] [-n holds] [-t trace]\n", name);
+  exit(1);
+}
+
+int main(int argc, char** argv) {
+  const char* dist = "exp";
+  const char* trace = NULL;
+  int pending = 100000;
+  int holds = 1000000;
+  int count, i;
+  op_t* ops;
+  heap_t heap;
+  calendar_t cal;
+  queue_ops_t queues[2];
+  unsigned long long checksums[2];
+
+  for (i = 1; i < argc; i++) {
+    if (i + 1 >= argc) {
+      usage(argv[0]);
+    }
+    if (strcmp(argv[i], "-d") == 0) {dist = argv[++i];}
+    else if (strcmp(argv[i], "-q") == 0) {pending = atoi(argv[++i]);}
+    else if (strcmp(argv[i], "-n") == 0) {holds = atoi(argv[++i]);}
+    else if (strcmp(argv[i], "-t") == 0) {trace = argv[++i];}
+    else {usage(argv[0]);}
+  }
+
+  srandom(1);
+  if (trace != NULL) {
+    ops = read_trace_ops(trace, &count);
+    printf("Replaying %i operations from %s.\n", count, trace);
+  }
+  else {
+    ops = make_hold_ops(dist, pending, holds, &count);
+    printf("Hold model: %i pending, %i holds, %s increments.\n", pending, holds, dist);
+  }
+
+  init_heap(&heap);
+  init_calendar(&cal);
+  queues[0].name = "heap";
+  queues[0].queue = &heap;
+  queues[0].insert = q_heap_insert;
+  queues[0].pop = q_heap_pop;
+  queues[0].is_empty = q_heap_is_empty;
+  queues[1].name = "calendar";
+  queues[1].queue = &cal;
+  queues[1].insert = q_cal_insert;
+  queues[1].pop = q_cal_pop;
+  queues[1].is_empty = q_cal_is_empty;
+
+  for (i = 0; i < 2; i++) {
+    double elapsed;
+    checksums[i] = run(&queues[i], ops, count, &elapsed);
+    printf("%-10s %8.3f s  %8.1f ns/op\n", queues[i].name, elapsed, (elapsed * 1e9) / count);
+  }
+  if (checksums[0] != checksums[1]) {
+    printf("ERROR: backends popped different key sequences.\n");
+    return 1;
+  }
+  return 0;
+}
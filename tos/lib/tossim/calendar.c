@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *   FILE: calendar.c
+ *   DESC: Calendar queue for discrete event simulation. See calendar.h.
+ */
+
+#include <calendar.h>
+#include <string.h> // For memmove(3)
+#include <stdlib.h>
+
+enum {
+  CALENDAR_START_BUCKETS = 2,
+  CALENDAR_BUCKET_LOCAL_SIZE = 2,
+  CALENDAR_SAMPLE_SIZE = 25,
+};
+
+typedef struct calendar_node {
+  void* data;
+  long long int key;
+} calendar_node_t;
+
+// Nodes in a bucket are sorted by increasing key and occupy
+// nodes[head] to nodes[head + size - 1]. Popping the minimum just
+// advances head, and since most new events are later than the ones
+// already pending, most inserts append at the end. Most buckets hold
+// only one or two nodes, so these are stored in the bucket itself
+// (nodes is NULL) to avoid a second cache miss per operation.
+typedef struct calendar_bucket {
+  int head;
+  int size;
+  int private_size;
+  calendar_node_t* nodes;
+  calendar_node_t local[CALENDAR_BUCKET_LOCAL_SIZE];
+} calendar_bucket_t;
+
+#define CALENDAR_BUCKET(cal, index) (((calendar_bucket_t*)((cal)->buckets))[index])
+#define CALENDAR_NODES(bucket) (((bucket)->nodes != NULL)? (bucket)->nodes : (bucket)->local)
+
+static void calendar_setup(calendar_t* cal, int num_buckets, long long int width) {
+  cal->size = 0;
+  cal->num_buckets = num_buckets;
+  cal->width = (width > 0)? width : 1;
+  cal->buckets = malloc(sizeof(calendar_bucket_t) * num_buckets);
+  memset(cal->buckets, 0, sizeof(calendar_bucket_t) * num_buckets);
+  cal->last_bucket = 0;
+  cal->bucket_top = cal->width;
+}
+
+void init_calendar(calendar_t* cal) {
+  calendar_setup(cal, CALENDAR_START_BUCKETS, 1);
+  cal->resize_enabled = 1;
+}
+
+int calendar_size(calendar_t* cal) {
+  return cal->size;
+}
+
+int calendar_is_empty(calendar_t* cal) {
+  return cal->size == 0;
+}
+
+static inline int calendar_bucket_index(calendar_t* cal, long long int key) {
+  return (int)((key / cal->width) & (cal->num_buckets - 1));
+}
+
+// Insert a node into a bucket. A new node goes behind any nodes with
+// an equal key, so equal keys pop in insertion order. A node that is
+// being put back (see calendar_new_width) goes in front of them.
+static void calendar_bucket_insert(calendar_bucket_t* bucket, void* data, long long int key, int put_back) {
+  calendar_node_t* nodes = CALENDAR_NODES(bucket);
+  int capacity = (bucket->nodes != NULL)? bucket->private_size : CALENDAR_BUCKET_LOCAL_SIZE;
+  int lo, hi;
+  
+  if (bucket->head + bucket->size == capacity) {
+    if (bucket->head > bucket->size || (bucket->head > 0 && bucket->nodes == NULL)) {
+      memmove(nodes, &nodes[bucket->head], sizeof(calendar_node_t) * bucket->size);
+    }
+    else {
+      int new_size = capacity * 2;
+      calendar_node_t* new_nodes = (calendar_node_t*)malloc(sizeof(calendar_node_t) * new_size);
+      memcpy(new_nodes, &nodes[bucket->head], sizeof(calendar_node_t) * bucket->size);
+      free(bucket->nodes);
+      bucket->nodes = nodes = new_nodes;
+      bucket->private_size = new_size;
+    }
+    bucket->head = 0;
+  }
+
+  lo = bucket->head;
+  hi = bucket->head + bucket->size;
+  // Fast path: the new key is the largest.
+  if (bucket->size == 0 || nodes[hi - 1].key < key ||
+      (!put_back && nodes[hi - 1].key == key)) {
+    lo = hi;
+  }
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    long long int mid_key = nodes[mid].key;
+    if (mid_key < key || (!put_back && mid_key == key)) {
+      lo = mid + 1;
+    }
+    else {
+      hi = mid;
+    }
+  }
+  
+  memmove(&nodes[lo + 1], &nodes[lo], sizeof(calendar_node_t) * (bucket->head + bucket->size - lo));
+  nodes[lo].data = data;
+  nodes[lo].key = key;
+  bucket->size++;
+}
+
+// Move the cursor to the bucket holding the minimum key and return
+// its index. Scans at most one year of days starting at the cursor;
+// if that finds nothing (the queue is sparse relative to the bucket
+// width), falls back to a direct search of every bucket.
+static int calendar_locate_min(calendar_t* cal) {
+  int mask = cal->num_buckets - 1;
+  int index = cal->last_bucket;
+  long long int top = cal->bucket_top;
+  int min_index = -1;
+  long long int min_key = 0;
+  int i;
+  
+  for (i = 0; i < cal->num_buckets; i++) {
+    calendar_bucket_t* bucket = &CALENDAR_BUCKET(cal, index);
+    if (bucket->size > 0 && CALENDAR_NODES(bucket)[bucket->head].key < top) {
+      cal->last_bucket = index;
+      cal->bucket_top = top;
+      return index;
+    }
+    index = (index + 1) & mask;
+    top += cal->width;
+  }
+
+  for (i = 0; i < cal->num_buckets; i++) {
+    calendar_bucket_t* bucket = &CALENDAR_BUCKET(cal, i);
+    if (bucket->size > 0 &&
+        (min_index == -1 || CALENDAR_NODES(bucket)[bucket->head].key < min_key)) {
+      min_index = i;
+      min_key = CALENDAR_NODES(bucket)[bucket->head].key;
+    }
+  }
+  cal->last_bucket = min_index;
+  cal->bucket_top = ((min_key / cal->width) + 1) * cal->width;
+  return min_index;
+}
+
+long long int calendar_get_min_key(calendar_t* cal) {
+  calendar_bucket_t* bucket;
+  if (calendar_is_empty(cal)) {
+    return -1;
+  }
+  bucket = &CALENDAR_BUCKET(cal, calendar_locate_min(cal));
+  return CALENDAR_NODES(bucket)[bucket->head].key;
+}
+
+void* calendar_peek_min_data(calendar_t* cal) {
+  calendar_bucket_t* bucket;
+  if (calendar_is_empty(cal)) {
+    return NULL;
+  }
+  bucket = &CALENDAR_BUCKET(cal, calendar_locate_min(cal));
+  return CALENDAR_NODES(bucket)[bucket->head].data;
+}
+
+static void calendar_resize(calendar_t* cal, int num_buckets);
+
+static void* calendar_pop(calendar_t* cal, long long int* key) {
+  calendar_bucket_t* bucket = &CALENDAR_BUCKET(cal, calendar_locate_min(cal));
+  calendar_node_t* node;
+  node = &CALENDAR_NODES(bucket)[bucket->head];
+  bucket->size--;
+  bucket->head = (bucket->size == 0)? 0 : bucket->head + 1;
+  cal->size--;
+  if (key != NULL) {
+    *key = node->key;
+  }
+  return node->data;
+}
+
+void* calendar_pop_min_data(calendar_t* cal, long long int* key) {
+  void* data;
+  if (calendar_is_empty(cal)) {
+    return NULL;
+  }
+  data = calendar_pop(cal, key);
+  if (cal->resize_enabled &&
+      cal->num_buckets > CALENDAR_START_BUCKETS &&
+      cal->size < cal->num_buckets / 2) {
+    calendar_resize(cal, cal->num_buckets / 2);
+  }
+  return data;
+}
+
+int calendar_remove(calendar_t* cal, void* data, long long int key) {
+  calendar_bucket_t* bucket = &CALENDAR_BUCKET(cal, calendar_bucket_index(cal, key));
+  calendar_node_t* nodes = CALENDAR_NODES(bucket);
+  int lo = bucket->head;
+  int hi = bucket->head + bucket->size;
+
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (nodes[mid].key < key) {
+      lo = mid + 1;
+    }
+    else {
+      hi = mid;
+    }
+  }
+  for (; lo < bucket->head + bucket->size && nodes[lo].key == key; lo++) {
+    if (nodes[lo].data == data) {
+      memmove(&nodes[lo], &nodes[lo + 1], sizeof(calendar_node_t) * (bucket->head + bucket->size - lo - 1));
+      bucket->size--;
+      if (bucket->size == 0) {
+        bucket->head = 0;
+      }
+      cal->size--;
+      if (cal->resize_enabled &&
+          cal->num_buckets > CALENDAR_START_BUCKETS &&
+          cal->size < cal->num_buckets / 2) {
+        calendar_resize(cal, cal->num_buckets / 2);
+      }
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static void calendar_place(calendar_t* cal, void* data, long long int key, int put_back) {
+  int index = calendar_bucket_index(cal, key);
+  // Keep the invariant that no key lies before the cursor's day.
+  if (cal->size == 0 || key < cal->bucket_top - cal->width) {
+    cal->last_bucket = index;
+    cal->bucket_top = ((key / cal->width) + 1) * cal->width;
+  }
+  calendar_bucket_insert(&CALENDAR_BUCKET(cal, index), data, key, put_back);
+  cal->size++;
+}
+
+void calendar_insert(calendar_t* cal, void* data, long long int key) {
+  calendar_place(cal, data, key, 0);
+  if (cal->resize_enabled && cal->size > cal->num_buckets * 2) {
+    calendar_resize(cal, cal->num_buckets * 2);
+  }
+}
+
+// Estimate a bucket width from the spacing of the next few keys to
+// be popped. As in Brown's paper, separations more than twice the
+// average are discarded and the width is three times the average of
+// those that remain.
+static long long int calendar_new_width(calendar_t* cal) {
+  calendar_node_t sample[CALENDAR_SAMPLE_SIZE];
+  int count = (cal->size < CALENDAR_SAMPLE_SIZE)? cal->size : CALENDAR_SAMPLE_SIZE;
+  long long int average;
+  long long int total = 0;
+  int used = 0;
+  int i;
+  
+  if (count < 2) {
+    return cal->width;
+  }
+  
+  for (i = 0; i < count; i++) {
+    sample[i].data = calendar_pop(cal, &sample[i].key);
+  }
+  for (i = count - 1; i >= 0; i--) {
+    calendar_place(cal, sample[i].data, sample[i].key, 1);
+  }
+  
+  average = (sample[count - 1].key - sample[0].key) / (count - 1);
+  for (i = 1; i < count; i++) {
+    long long int separation = sample[i].key - sample[i - 1].key;
+    if (separation <= average * 2) {
+      total += separation;
+      used++;
+    }
+  }
+
+  if (total == 0) {
+    // All of the sampled keys are equal. Use the gap to the next
+    // distinct key, so each group of equal keys gets its own day.
+    long long int next = -1;
+    for (i = 0; i < cal->num_buckets; i++) {
+      calendar_bucket_t* bucket = &CALENDAR_BUCKET(cal, i);
+      calendar_node_t* nodes = CALENDAR_NODES(bucket);
+      int j;
+      for (j = bucket->head; j < bucket->head + bucket->size; j++) {
+        if (nodes[j].key > sample[0].key && (next == -1 || nodes[j].key < next)) {
+          next = nodes[j].key;
+        }
+      }
+    }
+    return (next == -1)? cal->width : next - sample[0].key;
+  }
+  return (3 * total) / used;
+}
+
+static void calendar_resize(calendar_t* cal, int num_buckets) {
+  calendar_bucket_t* old_buckets = (calendar_bucket_t*)cal->buckets;
+  int old_num_buckets = cal->num_buckets;
+  long long int width = calendar_new_width(cal);
+  int i, j;
+
+  calendar_setup(cal, num_buckets, width);
+  for (i = 0; i < old_num_buckets; i++) {
+    calendar_bucket_t* bucket = &old_buckets[i];
+    calendar_node_t* nodes = CALENDAR_NODES(bucket);
+    for (j = bucket->head; j < bucket->head + bucket->size; j++) {
+      calendar_place(cal, nodes[j].data, nodes[j].key, 0);
+    }
+    free(bucket->nodes);
+  }
+  free(old_buckets);
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * A calendar queue (R. Brown, CACM 31(10), 1988) with the same
+ * interface as heap.h. Keys are spread over an array of buckets
+ * ("days") of a fixed width; each bucket is a small array kept in
+ * sorted order. Insert and pop are O(1) amortized when the bucket
+ * width tracks the spacing of the pending keys, which the queue
+ * re-estimates whenever it grows or shrinks the bucket array.
+ * Like the heap, entries with equal keys pop in insertion order.
+ *
+ * The event queue uses this instead of the binary heap when TOSSIM
+ * is compiled with -DTOSSIM_CALENDAR_QUEUE, e.g.
+ *   CFLAGS += -DTOSSIM_CALENDAR_QUEUE
+ * in an application Makefile.
+ *
+ * @date   Oct 18 2026
+ */
+
+#ifndef CALENDAR_H_INCLUDED
+#define CALENDAR_H_INCLUDED
+
+typedef struct calendar {
+  int size;             // Number of entries in the queue
+  int num_buckets;      // Always a power of two
+  long long int width;  // Span of keys covered by one bucket
+  void* buckets;
+  int last_bucket;      // Bucket the scan for the minimum starts at
+  long long int bucket_top; // Upper bound (exclusive) of last_bucket's day
+  int resize_enabled;
+} calendar_t;
+
+void init_calendar(calendar_t* cal);
+int calendar_size(calendar_t* cal);
+int calendar_is_empty(calendar_t* cal);
+
+long long int calendar_get_min_key(calendar_t* cal);
+void* calendar_peek_min_data(calendar_t* cal);
+void* calendar_pop_min_data(calendar_t* cal, long long int* key);
+void calendar_insert(calendar_t* cal, void* data, long long int key);
+// Removes an entry, which must have been inserted with the given key.
+// Returns 1 if it was found, 0 otherwise.
+int calendar_remove(calendar_t* cal, void* data, long long int key);
+
+#endif // CALENDAR_H_INCLUDED
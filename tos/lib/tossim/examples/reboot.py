@@ -0,0 +1,62 @@
+# Checks that a mote can be turned off, turned on and rescheduled to
+# boot many times, with other motes' events queued in between. It
+# can be used with any TinyOS application compiled for sim; it exits
+# with status 1 if a boot is lost or happens at the wrong time.
+#
+# Cancelling a boot event returns it to the event pool, where the
+# next event allocated (here, mote 1's boot) reuses it. SimMoteP must
+# not touch it after that.
+
+import sys
+from tinyos.tossim.TossimApp import *
+from TOSSIM import *
+
+n = NescApp()
+t = Tossim(n.variables.variables())
+m = t.getNode(0)
+o = t.getNode(1)
+ms = t.ticksPerSecond() / 1000
+errors = 0
+
+def check(what, mote, on, boot):
+  global errors
+  if mote.isOn() != on or (on and mote.bootTime() != boot):
+    print "FAIL: %s: on %s boot %d, expected on %s boot %d" % (what, mote.isOn(), mote.bootTime(), on, boot)
+    errors += 1
+
+for i in range(0, 20):
+  base = t.time() + ms
+
+  # Moving a pending boot, and booting at the same time twice.
+  m.bootAtTime(base + 100 * ms)
+  m.bootAtTime(base + 100 * ms)
+  m.bootAtTime(base + 200 * ms)
+  o.bootAtTime(base + 150 * ms)
+  t.runUntil(base + 150 * ms)
+  check("moved boot", m, False, 0)
+  t.runUntil(base + 300 * ms)
+  check("moved boot", m, True, base + 200 * ms)
+  check("other mote", o, True, base + 150 * ms)
+
+  # turnOn() cancels the pending boot; the other mote's boot event
+  # then takes its place in the pool.
+  m.turnOff()
+  o.turnOff()
+  m.bootAtTime(base + 400 * ms)
+  m.turnOn()
+  o.bootAtTime(base + 450 * ms)
+  m.turnOff()
+  m.bootAtTime(base + 600 * ms)
+  t.runUntil(base + 500 * ms)
+  check("cancelled boot", m, False, 0)
+  check("other mote after cancel", o, True, base + 450 * ms)
+  t.runUntil(base + 700 * ms)
+  check("reboot", m, True, base + 600 * ms)
+
+  m.turnOff()
+  o.turnOff()
+
+if errors:
+  print errors, "errors"
+  sys.exit(1)
+print "OK"
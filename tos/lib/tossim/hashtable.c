@@ -1,30 +1,22 @@
 /* Copyright (C) 2004 Christopher Clark <firstname.lastname@cl.cam.ac.uk> */
 
+/* Open addressing with linear probing. Each slot holds the key, the
+ * value and the key's (mixed) hash, so probing compares hashes
+ * before calling the key comparison, and an insert allocates
+ * nothing unless the table has to grow. Removal shifts later entries
+ * of the same run back rather than leaving tombstones. */
+
 #include "hashtable.h"
 #include "hashtable_private.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
-#include <math.h>
-
-/*
-Credit for primes table: Aaron Krowne
- http://br.endernet.org/~akrowne/
- http://planetmath.org/encyclopedia/GoodHashTablePrimes.html
-*/
-static const unsigned int primes[] = {
-53, 97, 193, 389,
-769, 1543, 3079, 6151,
-12289, 24593, 49157, 98317,
-196613, 393241, 786433, 1572869,
-3145739, 6291469, 12582917, 25165843,
-50331653, 100663319, 201326611, 402653189,
-805306457, 1610612741
-};
-const unsigned int prime_table_length = sizeof(primes)/sizeof(primes[0]);
-const float max_load_factor = 0.65;
-
 
+/* Grow at 5/8 full; linear probing degrades quickly past that. */
+static unsigned int
+loadLimit(unsigned int size) {
+    return (size >> 1) + (size >> 3);
+}
 
 /*****************************************************************************/
 struct hashtable *
@@ -33,24 +25,20 @@ create_hashtable(unsigned int minsize,
                  int (*eqf) (void*,void*))
 {
     struct hashtable *h;
-    unsigned int pindex, size = primes[0];
+    unsigned int size = 64;
     /* Check requested hashtable isn't too large */
     if (minsize > (1u << 30)) return NULL;
-    /* Enforce size as prime */
-    for (pindex=0; pindex < prime_table_length; pindex++) {
-        if (primes[pindex] > minsize) { size = primes[pindex]; break; }
-    }
+    /* Enforce size as a power of two that holds minsize entries */
+    while (loadLimit(size) < minsize) size <<= 1;
     h = (struct hashtable *)malloc(sizeof(struct hashtable));
     if (NULL == h) return NULL; /*oom*/
-    h->table = (struct entry **)malloc(sizeof(struct entry*) * size);
+    h->table = (struct entry *)calloc(size, sizeof(struct entry));
     if (NULL == h->table) { free(h); return NULL; } /*oom*/
-    memset(h->table, 0, size * sizeof(struct entry *));
     h->tablelength  = size;
-    h->primeindex   = pindex;
     h->entrycount   = 0;
     h->hashfn       = hashf;
     h->eqfn         = eqf;
-    h->loadlimit    = (unsigned int) ceil(size * max_load_factor);
+    h->loadlimit    = loadLimit(size);
     return h;
 }
 
@@ -73,57 +61,28 @@ static int
 hashtable_expand(struct hashtable *h)
 {
     /* Double the size of the table to accomodate more entries */
-    struct entry **newtable;
-    struct entry *e;
-    struct entry **pE;
+    struct entry *newtable;
     unsigned int newsize, i, tindex;
     /* Check we're not hitting max capacity */
-    if (h->primeindex == (prime_table_length - 1)) return 0;
-    newsize = primes[++(h->primeindex)];
-
-    newtable = (struct entry **)malloc(sizeof(struct entry*) * newsize);
-    if (NULL != newtable)
-    {
-        memset(newtable, 0, newsize * sizeof(struct entry *));
-        /* This algorithm is not 'stable'. ie. it reverses the list
-         * when it transfers entries between the tables */
-        for (i = 0; i < h->tablelength; i++) {
-            while (NULL != (e = h->table[i])) {
-                h->table[i] = e->next;
-                tindex = indexFor(newsize,e->h);
-                e->next = newtable[tindex];
-                newtable[tindex] = e;
-            }
-        }
-        free(h->table);
-        h->table = newtable;
-    }
-    /* Plan B: realloc instead */
-    else 
-    {
-        newtable = (struct entry **)
-                   realloc(h->table, newsize * sizeof(struct entry *));
-        if (NULL == newtable) { (h->primeindex)--; return 0; }
-        h->table = newtable;
-        memset(newtable[h->tablelength], 0, newsize - h->tablelength);
-        for (i = 0; i < h->tablelength; i++) {
-            for (pE = &(newtable[i]), e = *pE; e != NULL; e = *pE) {
-                tindex = indexFor(newsize,e->h);
-                if (tindex == i)
-                {
-                    pE = &(e->next);
-                }
-                else
-                {
-                    *pE = e->next;
-                    e->next = newtable[tindex];
-                    newtable[tindex] = e;
-                }
+    if (h->tablelength >= (1u << 31)) return 0;
+    newsize = h->tablelength << 1;
+
+    newtable = (struct entry *)calloc(newsize, sizeof(struct entry));
+    if (NULL == newtable) return 0;
+    for (i = 0; i < h->tablelength; i++) {
+        struct entry *e = &(h->table[i]);
+        if (NULL != e->k) {
+            tindex = indexFor(newsize, e->h);
+            while (NULL != newtable[tindex].k) {
+                tindex = indexFor(newsize, tindex + 1);
             }
+            newtable[tindex] = *e;
         }
     }
+    free(h->table);
+    h->table = newtable;
     h->tablelength = newsize;
-    h->loadlimit   = (unsigned int) ceil(newsize * max_load_factor);
+    h->loadlimit   = loadLimit(newsize);
     return -1;
 }
 
@@ -138,80 +97,84 @@ hashtable_count(struct hashtable *h)
 int hashtable_insert(struct hashtable *h, void *k, void *v)
 {
     /* This method allows duplicate keys - but they shouldn't be used */
-    unsigned int tindex;
-    struct entry *e;
-    if (++(h->entrycount) > h->loadlimit)
+    unsigned int hashvalue, tindex;
+    if (h->entrycount + 1 > h->loadlimit)
     {
-        /* Ignore the return value. If expand fails, we should
-         * still try cramming just this value into the existing table
-         * -- we may not have memory for a larger table, but one more
-         * element may be ok. Next time we insert, we'll try expanding again.*/
-        hashtable_expand(h);
+        /* If expand fails, still try cramming this value into the
+         * existing table, as long as one slot stays empty to end
+         * searches. Next time we insert, we'll try expanding again. */
+        if (!hashtable_expand(h) && h->entrycount + 2 > h->tablelength) {
+            return 0;
+        }
     }
-    e = (struct entry *)malloc(sizeof(struct entry));
-    if (NULL == e) { --(h->entrycount); return 0; } /*oom*/
-
-    e->h = hash(h,k);
-    tindex = indexFor(h->tablelength,e->h);
-    e->k = k;
-    e->v = v;
-    e->next = h->table[tindex];
-    h->table[tindex] = e;
+    hashvalue = hash(h,k);
+    tindex = indexFor(h->tablelength, hashvalue);
+    while (NULL != h->table[tindex].k) {
+        tindex = indexFor(h->tablelength, tindex + 1);
+    }
+    h->table[tindex].k = k;
+    h->table[tindex].v = v;
+    h->table[tindex].h = hashvalue;
+    h->entrycount++;
     return -1;
 }
 
 /*****************************************************************************/
-void * /* returns value associated with key */
-hashtable_search(struct hashtable *h, void *k)
+static struct entry *
+hashtable_find(struct hashtable *h, void *k)
 {
     struct entry *e;
     unsigned int hashvalue, tindex;
     hashvalue = hash(h,k);
     tindex = indexFor(h->tablelength,hashvalue);
-    e = h->table[tindex];
-    while (NULL != e)
+    for (e = &(h->table[tindex]); NULL != e->k; e = &(h->table[tindex]))
     {
         /* Check hash value to short circuit heavier comparison */
-      if ((hashvalue == e->h) && (h->eqfn(k, e->k))) {
-	return e->v;
-      }
-      e = e->next;
+        if ((hashvalue == e->h) && (h->eqfn(k, e->k))) {
+            return e;
+        }
+        tindex = indexFor(h->tablelength, tindex + 1);
     }
     return NULL;
 }
 
 /*****************************************************************************/
 void * /* returns value associated with key */
-hashtable_remove(struct hashtable *h, void *k)
+hashtable_search(struct hashtable *h, void *k)
 {
-    /* TODO: consider compacting the table when the load factor drops enough,
-     *       or provide a 'compact' method. */
+    struct entry *e = hashtable_find(h, k);
+    return (NULL == e)? NULL : e->v;
+}
 
-    struct entry *e;
-    struct entry **pE;
+/*****************************************************************************/
+void * /* returns value associated with key */
+hashtable_remove(struct hashtable *h, void *k)
+{
+    struct entry *e = hashtable_find(h, k);
+    unsigned int hole, i, home;
     void *v;
-    unsigned int hashvalue, tindex;
 
-    hashvalue = hash(h,k);
-    tindex = indexFor(h->tablelength,hash(h,k));
-    pE = &(h->table[tindex]);
-    e = *pE;
-    while (NULL != e)
-    {
-        /* Check hash value to short circuit heavier comparison */
-        if ((hashvalue == e->h) && (h->eqfn(k, e->k)))
-        {
-            *pE = e->next;
-            h->entrycount--;
-            v = e->v;
-            freekey(e->k);
-            free(e);
-            return v;
+    if (NULL == e) return NULL;
+    v = e->v;
+    freekey(e->k);
+    h->entrycount--;
+
+    /* Move later entries of the run back into the hole whenever the
+     * hole lies between their home slot and where they are now. */
+    hole = (unsigned int)(e - h->table);
+    i = hole;
+    for (;;) {
+        i = indexFor(h->tablelength, i + 1);
+        if (NULL == h->table[i].k) break;
+        home = indexFor(h->tablelength, h->table[i].h);
+        if (indexFor(h->tablelength, i - home) >= indexFor(h->tablelength, i - hole)) {
+            h->table[hole] = h->table[i];
+            hole = i;
         }
-        pE = &(e->next);
-        e = e->next;
     }
-    return NULL;
+    h->table[hole].k = NULL;
+    h->table[hole].v = NULL;
+    return v;
 }
 
 /*****************************************************************************/
@@ -220,24 +183,13 @@ void
 hashtable_destroy(struct hashtable *h, int free_values)
 {
     unsigned int i;
-    struct entry *e, *f;
-    struct entry **table = h->table;
-    if (free_values)
-    {
-        for (i = 0; i < h->tablelength; i++)
-        {
-            e = table[i];
-            while (NULL != e)
-            { f = e; e = e->next; freekey(f->k); free(f->v); free(f); }
-        }
-    }
-    else
+    struct entry *table = h->table;
+    for (i = 0; i < h->tablelength; i++)
     {
-        for (i = 0; i < h->tablelength; i++)
+        if (NULL != table[i].k)
         {
-            e = table[i];
-            while (NULL != e)
-            { f = e; e = e->next; freekey(f->k); free(f); }
+            freekey(table[i].k);
+            if (free_values) free(table[i].v);
         }
     }
     free(h->table);
@@ -85,17 +85,18 @@ create_hashtable(unsigned int minsize,
    
  * @name        hashtable_insert
  * @param   h   the hashtable to insert into
- * @param   k   the key - hashtable claims ownership and will free on removal
+ * @param   k   the key - hashtable claims ownership and will free on removal;
+ *              must not be NULL, which marks an empty slot
  * @param   v   the value - does not claim ownership
  * @return      non-zero for successful insertion
  *
  * This function will cause the table to expand if the insertion would take
  * the ratio of entries to table size over the maximum load factor.
+ * Entries are stored in the table itself, so an insertion allocates
+ * nothing unless the table expands.
  *
  * This function does not check for repeated insertions with a duplicate key.
- * The value returned when using a duplicate key is undefined -- when
- * the hashtable changes size, the order of retrieval of duplicate key
- * entries is reversed.
+ * The value returned when using a duplicate key is undefined.
  * If in doubt, remove before insert.
  */
 
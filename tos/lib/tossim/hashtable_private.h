@@ -6,19 +6,18 @@
 #include "hashtable.h"
 
 /*****************************************************************************/
+/* A slot; k is NULL in an empty one. */
 struct entry
 {
     void *k, *v;
     unsigned int h;
-    struct entry *next;
 };
 
 struct hashtable {
-    unsigned int tablelength;
-    struct entry **table;
+    unsigned int tablelength; /* always a power of two */
+    struct entry *table;
     unsigned int entrycount;
     unsigned int loadlimit;
-    unsigned int primeindex;
     unsigned int (*hashfn) (void *k);
     int (*eqfn) (void *k1, void *k2);
 };
@@ -29,18 +28,12 @@ hash(struct hashtable *h, void *k);
 
 /*****************************************************************************/
 /* indexFor */
-static inline unsigned int
-indexFor(unsigned int tablelength, unsigned int hashvalue) {
-    return (hashvalue % tablelength);
-};
-
 /* Only works if tablelength == 2^N */
-/*static inline unsigned int
+static inline unsigned int
 indexFor(unsigned int tablelength, unsigned int hashvalue)
 {
     return (hashvalue & (tablelength - 1u));
 }
-*/
 
 /*****************************************************************************/
 #define freekey(X) free(X)
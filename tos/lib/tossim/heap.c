@@ -62,8 +62,14 @@ const int STARTING_SIZE = 511;
 typedef struct node {
   void* data;
   long long int key;
+  long long int seq; // Insertion order, to break ties between equal keys
 } node_t;
 
+// Nodes with equal keys are ordered by insertion, so the heap pops
+// them first-in first-out regardless of its shape.
+#define NODE_LESS(first, second) ((first).key < (second).key || \
+                                  ((first).key == (second).key && (first).seq < (second).seq))
+
 void down_heap(heap_t* heap, int findex);
 void up_heap(heap_t* heap, int findex);
 void swap(node_t* first, node_t* second);
@@ -73,10 +79,13 @@ node_t* next(node_t* next);
 void init_node(node_t* node) {
   node->data = NULL;
   node->key = -1;
+  node->seq = 0;
 }
 
 void init_heap(heap_t* heap) {
   heap->size = 0;
+  heap->sequence = 0;
+  heap->moved = NULL;
   heap->private_size = STARTING_SIZE;
   heap->data = malloc(sizeof(node_t) * heap->private_size);
 }
@@ -111,22 +120,56 @@ void* heap_peek_min_data(heap_t* heap) {
   }
 }
 
-void* heap_pop_min_data(heap_t* heap, long long int* key) {
-  int last_index = heap->size - 1;
-  void* data = HEAP_NODE(heap, 0).data;
-  if (key != NULL) {
-    *key = HEAP_NODE(heap, 0).key;
+void* heap_get_data(heap_t* heap, int index) {
+  if (index < 0 || index >= heap->size) {
+    return NULL;
+  }
+  else {
+    return HEAP_NODE(heap, index).data;
   }
-  HEAP_NODE(heap, 0).data = HEAP_NODE(heap, last_index).data;
-  HEAP_NODE(heap, 0).key = HEAP_NODE(heap, last_index).key;
+}
 
-  heap->size--;
+// Store a node at an index, telling the owner of its data where it
+// now is.
+static inline void place_node(heap_t* heap, int index, node_t node) {
+  HEAP_NODE(heap, index) = node;
+  if (heap->moved != NULL) {
+    heap->moved(node.data, index);
+  }
+}
 
-  down_heap(heap, 0);
+void* heap_remove(heap_t* heap, int index) {
+  int last_index = heap->size - 1;
+  void* data = HEAP_NODE(heap, index).data;
+
+  heap->size--;
 
+  // Fill the hole with the last node, which may have to move either
+  // up or down from there.
+  if (index != last_index) {
+    node_t last = HEAP_NODE(heap, last_index);
+    HEAP_NODE(heap, index) = last;
+    if (index > 0 && NODE_LESS(last, HEAP_NODE(heap, (index - 1) / 2))) {
+      up_heap(heap, index);
+    }
+    else {
+      down_heap(heap, index);
+    }
+  }
+  
+  if (heap->moved != NULL) {
+    heap->moved(data, -1);
+  }
   return data;
 }
 
+void* heap_pop_min_data(heap_t* heap, long long int* key) {
+  if (key != NULL) {
+    *key = HEAP_NODE(heap, 0).key;
+  }
+  return heap_remove(heap, 0);
+}
+
 void expand_heap(heap_t* heap) {
   int new_size = (heap->private_size * 2) + 1;
   void* new_data = malloc(sizeof(node_t) * new_size);
@@ -150,61 +193,58 @@ void heap_insert(heap_t* heap, void* data, long long int key) {
   findex = heap->size;
   HEAP_NODE(heap, findex).key = key;
   HEAP_NODE(heap, findex).data = data;
+  HEAP_NODE(heap, findex).seq = heap->sequence++;
   up_heap(heap, findex);
 
   heap->size++;
 }
 
 void swap(node_t* first, node_t* second) {
-  long long int key;
-  void* data;
-
-  key = first->key;
-  first->key = second->key;
-  second->key = key;
-
-  data = first->data;
-  first->data = second->data;
-  second->data = data;
+  node_t tmp = *first;
+  *first = *second;
+  *second = tmp;
 }
 
 void down_heap(heap_t* heap, int findex) {
-  int right_index =  ((findex + 1) * 2);
-  int left_index = (findex * 2) + 1;
+  node_t node = HEAP_NODE(heap, findex);
 
-  if (right_index < heap->size) { // Two children
-    long long int left_key = HEAP_NODE(heap, left_index).key;
-    long long int right_key = HEAP_NODE(heap, right_index).key;
-    int min_key_index = (left_key < right_key)? left_index : right_index;
+  // Sift the hole down rather than swapping at every level.
+  for (;;) {
+    int left_index = (findex * 2) + 1;
+    int right_index = left_index + 1;
+    int min_key_index;
 
-    if (HEAP_NODE(heap, min_key_index).key < HEAP_NODE(heap, findex).key) {
-      swap(&(HEAP_NODE(heap, findex)), &(HEAP_NODE(heap, min_key_index)));
-      down_heap(heap, min_key_index);
+    if (left_index >= heap->size) { // No children
+      break;
     }
-  }
-  else if (left_index >= heap->size) { // No children
-    return;
-  }
-  else { // Only left child
-    long long int left_key = HEAP_NODE(heap, left_index).key;
-    if (left_key < HEAP_NODE(heap, findex).key) {
-      swap(&(HEAP_NODE(heap, findex)), &(HEAP_NODE(heap, left_index)));
-      return;
+    min_key_index = left_index;
+    if (right_index < heap->size &&
+        NODE_LESS(HEAP_NODE(heap, right_index), HEAP_NODE(heap, left_index))) {
+      min_key_index = right_index;
+    }
+    if (NODE_LESS(HEAP_NODE(heap, min_key_index), node)) {
+      place_node(heap, findex, HEAP_NODE(heap, min_key_index));
+      findex = min_key_index;
+    }
+    else {
+      break;
     }
   }
+  place_node(heap, findex, node);
 }
 
 void up_heap(heap_t* heap, int findex) {
-  int parent_index;
-  if (findex == 0) {
-    return;
-  }
+  node_t node = HEAP_NODE(heap, findex);
 
-  parent_index = (findex - 1) / 2;
-
-  if (HEAP_NODE(heap, parent_index).key > HEAP_NODE(heap, findex).key) {
-    swap(&(HEAP_NODE(heap, findex)), &(HEAP_NODE(heap, parent_index)));
-    up_heap(heap, parent_index);
+  while (findex > 0) {
+    int parent_index = (findex - 1) / 2;
+    if (NODE_LESS(node, HEAP_NODE(heap, parent_index))) {
+      place_node(heap, findex, HEAP_NODE(heap, parent_index));
+      findex = parent_index;
+    }
+    else {
+      break;
+    }
   }
+  place_node(heap, findex, node);
 }
-
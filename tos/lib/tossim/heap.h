@@ -62,6 +62,11 @@ typedef struct heap {
   int size;
   void* data;
   int private_size;
+  long long int sequence; // Number of insertions, for FIFO tie-breaking
+  // If not NULL, called whenever an entry moves to a new index, and
+  // with an index of -1 when it is popped or removed. This lets the
+  // owner of an entry remove it without searching for it.
+  void (*moved)(void* data, int index);
 } heap_t;
 
 void init_heap(heap_t* heap);
@@ -71,6 +76,9 @@ int heap_is_empty(heap_t* heap);
 long long int heap_get_min_key(heap_t* heap);
 void* heap_peek_min_data(heap_t* heap);
 void* heap_pop_min_data(heap_t* heap, long long int* key);
+void* heap_get_data(heap_t* heap, int index);
+void* heap_remove(heap_t* heap, int index);
+// Entries with equal keys are popped in the order they were inserted.
 void heap_insert(heap_t * heap, void* data, long long int key);
 
 
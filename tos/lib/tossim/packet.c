@@ -113,8 +113,11 @@ sim_packet_t* Packet::getPacket() {
   return msgPtr;
 }
 
+// The event queue holds on to the message until it is received, so it
+// gets a copy, which it frees after delivery: this Packet can then be
+// changed, delivered again or freed in the meantime.
 void Packet::deliver(int node, long long int t) {
-  sim_packet_deliver(node, msgPtr, t);
+  sim_packet_deliver(node, sim_packet_copy(msgPtr), t);
 }
 
 void Packet::deliverNow(int node) {
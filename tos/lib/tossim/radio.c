@@ -39,6 +39,7 @@
 
 #include <radio.h>
 #include <sim_gain.h>
+#include <sim_prr.h>
 
 Radio::Radio() {}
 Radio::~Radio() {}
@@ -59,11 +60,31 @@ void Radio::remove(int src, int dest) {
   sim_gain_remove(src, dest);
 }
 
+void Radio::addLinks(const double* links, int count) {
+  sim_gain_add_links(links, count);
+}
+
+int Radio::loadGainFile(char* path) {
+  return sim_gain_load_file(path);
+}
+
 void Radio::setNoise(int node, double mean, double range) {
   sim_gain_set_noise_floor(node, mean, range);
 }
 
 
+// floors holds count (node, mean, range) triples.
+void Radio::setNoiseFloors(const double* floors, int count) {
+  int i;
+  for (i = 0; i < count; i++) {
+    sim_gain_set_noise_floor((int)floors[3 * i], floors[3 * i + 1], floors[3 * i + 2]);
+  }
+}
+
 void Radio::setSensitivity(double sensitivity) {
   sim_gain_set_sensitivity(sensitivity);
 }
+
+void Radio::setPrrCurve(double beta1, double beta2, int length) {
+  sim_prr_set_curve(beta1, beta2, length);
+}
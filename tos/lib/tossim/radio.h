@@ -49,8 +49,12 @@ class Radio {
   double gain(int src, int dest);
   bool connected(int src, int dest);
   void remove(int src, int dest);
+  void addLinks(const double* links, int count);
+  int loadGainFile(char* path);
   void setNoise(int node, double mean, double range);
+  void setNoiseFloors(const double* floors, int count);
   void setSensitivity(double sensitivity);
+  void setPrrCurve(double beta1, double beta2, int length);
 };
 
 #endif
@@ -50,6 +50,38 @@
 #include <radio.h>
 %}
 
+// addLinks() takes any object exporting a buffer of doubles, such
+// as array.array('d') or a numpy float64 array, holding (src, dest,
+// gain) triples. The buffer is read in place.
+%typemap(in) (const double* links, int count) {
+  const void* buf;
+  Py_ssize_t len;
+  if (PyObject_AsReadBuffer($input, &buf, &len) != 0) {
+    return NULL;
+  }
+  if (len % (3 * sizeof(double)) != 0) {
+    PyErr_SetString(PyExc_ValueError, "Requires a buffer of (src, dest, gain) double triples.");
+    return NULL;
+  }
+  $1 = (double*)buf;
+  $2 = (int)(len / (3 * sizeof(double)));
+}
+
+// setNoiseFloors() does the same with (node, mean, range) triples.
+%typemap(in) (const double* floors, int count) {
+  const void* buf;
+  Py_ssize_t len;
+  if (PyObject_AsReadBuffer($input, &buf, &len) != 0) {
+    return NULL;
+  }
+  if (len % (3 * sizeof(double)) != 0) {
+    PyErr_SetString(PyExc_ValueError, "Requires a buffer of (node, mean, range) double triples.");
+    return NULL;
+  }
+  $1 = (double*)buf;
+  $2 = (int)(len / (3 * sizeof(double)));
+}
+
 class Radio {
  public:
   Radio();
@@ -59,7 +91,11 @@ class Radio {
   double gain(int src, int dest);
   bool connected(int src, int dest);
   void remove(int src, int dest);
+  void addLinks(const double* links, int count);
+  int loadGainFile(char* path);
   void setNoise(int node, double mean, double range);
+  void setNoiseFloors(const double* floors, int count);
   void setSensitivity(double sensitivity);   
+  void setPrrCurve(double beta1, double beta2, int length);
 };
 
@@ -68,3 +68,8 @@ void SerialForwarder::process ()
 {
     sim_sf_process();
 }
+
+void SerialForwarder::setPollInterval(int usec)
+{
+    sim_sf_set_poll_interval(usec);
+}
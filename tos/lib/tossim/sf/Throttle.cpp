@@ -40,78 +40,43 @@
 #include "Throttle.h"
 
 Throttle::Throttle(Tossim* tossim, const int ms = 10) : 
-    sim(tossim), simStartTime(0.0), simEndTime(0.0), simPace(0), throttleCount(0) {
+    sim(tossim), simStartTime(0.0), simEndTime(0.0), simPace(0) {
 
         // Convert milliseconds to sim_time_t 
-        simPace =  ms * 10000000ULL;
+        simPace = ms * (sim->ticksPerSecond() / 1000);
 }
 
 Throttle::~Throttle() {}
 
+/* The pacing itself is done by the simulation's run loop, which
+   checks the monotonic clock at most once per pace interval of
+   simulated time. */
 void Throttle::initialize() {
     simStartTime = getTime();
+    simEndTime = 0.0;
+    sim->setPace(1.0, simPace);
 }
 
 void Throttle::finalize() {
     simEndTime = getTime();
+    sim->setPace(0.0, simPace);
 }
 
+/* Kept for existing scripts: runNextEvent() paces itself. */
 void Throttle::checkThrottle() {
-    
-    double secondsElasped = getTime() - simStartTime;
-    sim_time_t ticksElasped = (sim_time_t) secondsElasped*sim->ticksPerSecond();
-
-    sim_time_t difference = sim->time() - ticksElasped;
-
-    if (difference > simPace) {
-        throttleCount++;
-        double sleepDifference = (double) difference / sim->ticksPerSecond();
-        simSleep(sleepDifference);
-    }
-
-}
-
-inline double Throttle::toDouble(struct timeval* tv) {
-    return tv->tv_sec + tv->tv_usec/1e6;
 }
 
 double Throttle::getTime() {
-    struct timeval tv;
-    gettimeofday (&tv, NULL);
-    return toDouble(&tv);  
-}
-
-int Throttle::simSleep(double seconds) {
-
-     struct timespec tv;
-     /* Construct the timespec from the number of whole seconds... */
-     tv.tv_sec = (time_t) seconds;
-     /* ... and the remainder in nanoseconds. */
-     tv.tv_nsec = (long) ((seconds - tv.tv_sec) * 1e+9);
-
-     while (1)
-     {
-         /* Sleep for the time specified in tv. If interrupted by a
-         signal, place the remaining time left to sleep back into tv. */
-         int rval = nanosleep (&tv, &tv);
-
-         if (rval == 0)
-             /* Completed the entire sleep time; all done. */
-             return 0;
-         else if (errno == EINTR)
-             /* Interrupted by a signal. Try again. */
-             continue;
-         else 
-             /* Some other error; bail out. */
-             return rval;
-     }
-
-     return 0;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec/1e9;
 }
 
 void Throttle::printStatistics() {
 
-    printf("Number of throttle events %lu\n", throttleCount);
+    printf("Number of throttle events %lld\n", sim->paceSleeps());
+    printf("Time spent sleeping: %.6f\n", sim->paceSleepTime());
+    printf("Lag behind real time: %.6f now, %.6f max\n", sim->paceLag(), sim->paceMaxLag());
 
     if (simEndTime > 0.0) {
         printf("Total Sim Time: %.6f\n", simEndTime - simStartTime);
@@ -40,9 +40,7 @@
 #define  _THROTTLE_H_
 
 
-#include <errno.h>
 #include <time.h>
-#include <sys/time.h>
 #include "tossim.h"
 
 class Throttle {
@@ -60,16 +58,12 @@ class Throttle {
 
     private:
 
+        Tossim* sim;
+
         double simStartTime;
         double simEndTime;
         sim_time_t simPace;
 
-        Tossim* sim;
-
-        unsigned long throttleCount;
-
         double getTime();
-        double toDouble(struct timeval* tv);
-        int simSleep(double seconds);
 };
 #endif   // ----- #ifndef _THROTTLE_H_  ----- 
@@ -275,7 +275,7 @@ implementation {
     }
 
     sim_event_t* allocate_serial_deliver_event(int node, message_t* msg, sim_time_t t) {
-        sim_event_t* evt = (sim_event_t*)malloc(sizeof(sim_event_t));
+        sim_event_t* evt = sim_queue_allocate_event();
 	message_t* newMsg = (message_t*)malloc(sizeof(message_t));
         uint8_t payloadLength = ((serial_header_t*)msg->header)->length;
         memcpy(getHeader(newMsg), msg, sizeof(serial_header_t) + payloadLength);
@@ -48,6 +48,12 @@
 #include <stdio.h>
 #include <string.h>
 #include <signal.h>
+#include <time.h>
+#include <sys/uio.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#define SIM_SF_EPOLL
+#endif
 
 #include "sim_serial_forwarder.h"
 #include "sim_serial_packet.h"
@@ -57,6 +63,30 @@ struct sim_sf_client_list *sim_sf_clients;
 int sim_sf_server_socket;
 int sim_sf_packets_read, sim_sf_packets_written, sim_sf_num_clients;
 
+/* The sockets are only polled when the previous poll found something
+   to do or this many microseconds of wall-clock time have passed, so
+   calling sim_sf_process() after every event costs a clock read, not
+   a system call. */
+long sim_sf_poll_interval = 1000;
+struct timespec sim_sf_next_poll;
+
+#ifdef SIM_SF_EPOLL
+enum {
+    SIM_SF_MAX_EVENTS = 16,
+};
+int sim_sf_epoll_fd = -1;
+
+void sim_sf_epoll_ctl(int op, int fd)
+{
+    struct epoll_event ev;
+
+    memset(&ev, 0, sizeof ev);
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    epoll_ctl(sim_sf_epoll_fd, op, fd, &ev);
+}
+#endif
+
 int sim_sf_unix_check(const char *msg, int result)
 {
     if (result < 0)
@@ -103,6 +133,9 @@ void sim_sf_add_client(int fd)
     sim_sf_pstatus();
 
     c->fd = fd;
+#ifdef SIM_SF_EPOLL
+    sim_sf_epoll_ctl(EPOLL_CTL_ADD, fd);
+#endif
 }
 
 void sim_sf_rem_client(struct sim_sf_client_list **c)
@@ -112,6 +145,9 @@ void sim_sf_rem_client(struct sim_sf_client_list **c)
     *c = dead->next;
     sim_sf_num_clients--;
     sim_sf_pstatus();
+#ifdef SIM_SF_EPOLL
+    sim_sf_epoll_ctl(EPOLL_CTL_DEL, dead->fd);
+#endif
     close(dead->fd);
     free(dead);
 }
@@ -125,6 +161,25 @@ void sim_sf_new_client(int fd)
         sim_sf_add_client(fd);
 }
 
+int sim_sf_read_client(struct sim_sf_client_list **c)
+/* Effects: forwards one packet from client *c, or removes the client
+     if it has gone away
+   Returns: 0 if a packet was forwarded, -1 if the client was removed
+*/
+{
+    unsigned char packet[256];
+    unsigned char l;
+
+    if (sim_sf_saferead((*c)->fd, &l, 1) != 1 ||
+        sim_sf_saferead((*c)->fd, packet, l) != l)
+    {
+        sim_sf_rem_client(c);
+        return -1;
+    }
+    sim_sf_forward_packet(packet, l);
+    return 0;
+}
+
 void sim_sf_check_clients(fd_set *fds)
 {
     struct sim_sf_client_list **c;
@@ -133,22 +188,8 @@ void sim_sf_check_clients(fd_set *fds)
     {
         int isNext = 1;
 
-        if (FD_ISSET((*c)->fd, fds))
-        {
-            int len;
-            const void *packet = sim_sf_read_packet((*c)->fd, &len);
-
-            if (packet)
-            {
-                sim_sf_forward_packet(packet, len);
-                free((void *)packet);
-            }
-            else
-            {
-                sim_sf_rem_client(c);
-                isNext = 0;
-            }
-        }
+        if (FD_ISSET((*c)->fd, fds) && sim_sf_read_client(c) < 0)
+            isNext = 0;
         if (isNext)
             c = &(*c)->next;
     }
@@ -162,25 +203,54 @@ void sim_sf_wait_clients(fd_set *fds, int *maxfd)
         sim_sf_fd_wait(fds, maxfd, c->fd);
 }
 
+int sim_sf_write_dispatch(int fd, const void *packet, int len)
+/* Effects: writes packet to a client with the length and the leading
+     zero (serial packet type) byte the protocol expects, without
+     copying it
+   Returns: 0 if the packet was written, -1 otherwise
+*/
+{
+    unsigned char header[2];
+    struct iovec iov[2];
+    int total = len + 2;
+    int n;
+
+    header[0] = len + 1;
+    header[1] = 0;
+    iov[0].iov_base = header;
+    iov[0].iov_len = 2;
+    iov[1].iov_base = (void *)packet;
+    iov[1].iov_len = len;
+
+    do
+        n = writev(fd, iov, 2);
+    while (n == -1 && errno == EINTR);
+    if (n == -1)
+        return -1;
+    if (n < 2)
+    {
+        if (sim_sf_safewrite(fd, header + n, 2 - n) != 2 - n)
+            return -1;
+        n = 2;
+    }
+    if (n < total && sim_sf_safewrite(fd, (const char *)packet + (n - 2), total - n) != total - n)
+        return -1;
+
+    return 0;
+}
+
 void sim_sf_dispatch_packet(const void *packet, int len)
 {
     struct sim_sf_client_list **c;
 
-    char* dispatchPacket = (char*) sim_sf_xmalloc(len+1);
-    
-    memset(dispatchPacket, 0, len+1);
-    memcpy(dispatchPacket+1, packet, len);
-
     for (c = &sim_sf_clients; *c; )
-        if (sim_sf_write_packet((*c)->fd, dispatchPacket, len+1) >= 0)
+        if (sim_sf_write_dispatch((*c)->fd, packet, len) >= 0)
         {
             sim_sf_packets_written++;
             c = &(*c)->next;
         }
         else
             sim_sf_rem_client(c);
-
-    free(dispatchPacket);
 }
 
 void sim_sf_open_server_socket(int port)
@@ -200,6 +270,42 @@ void sim_sf_open_server_socket(int port)
 
     sim_sf_unix_check("bind", bind(sim_sf_server_socket, (struct sockaddr *)&me, sizeof me));
     sim_sf_unix_check("listen", listen(sim_sf_server_socket, 5));
+
+#ifdef SIM_SF_EPOLL
+    if (sim_sf_epoll_fd < 0)
+        sim_sf_epoll_fd = sim_sf_unix_check("epoll_create", epoll_create(8));
+    sim_sf_epoll_ctl(EPOLL_CTL_ADD, sim_sf_server_socket);
+#endif
+    sim_set_poll_hook(sim_sf_process);
+}
+
+void sim_sf_set_poll_interval(long usec)
+{
+    sim_sf_poll_interval = usec;
+    memset(&sim_sf_next_poll, 0, sizeof sim_sf_next_poll);
+}
+
+int sim_sf_poll_due(void)
+/* Returns: 1 if the sockets should be polled now; if so, the next
+     poll is scheduled sim_sf_poll_interval from now
+*/
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if (now.tv_sec < sim_sf_next_poll.tv_sec ||
+        (now.tv_sec == sim_sf_next_poll.tv_sec && now.tv_nsec < sim_sf_next_poll.tv_nsec))
+        return 0;
+
+    now.tv_sec += sim_sf_poll_interval / 1000000;
+    now.tv_nsec += (sim_sf_poll_interval % 1000000) * 1000;
+    if (now.tv_nsec >= 1000000000)
+    {
+        now.tv_sec++;
+        now.tv_nsec -= 1000000000;
+    }
+    sim_sf_next_poll = now;
+    return 1;
 }
 
 void sim_sf_check_new_client(void)
@@ -224,12 +330,44 @@ void sim_sf_forward_packet(const void *packet, int len)
 
 void sim_sf_process ()
 {
+#ifdef SIM_SF_EPOLL
+        struct epoll_event events[SIM_SF_MAX_EVENTS];
+        int newClient = 0;
+        int i, ret;
+
+        if (!sim_sf_poll_due())
+            return;
 
+        ret = epoll_wait(sim_sf_epoll_fd, events, SIM_SF_MAX_EVENTS, 0);
+        for (i = 0; i < ret; i++)
+        {
+            struct sim_sf_client_list **c;
+
+            if (events[i].data.fd == sim_sf_server_socket)
+            {
+                newClient = 1;
+                continue;
+            }
+            for (c = &sim_sf_clients; *c; c = &(*c)->next)
+                if ((*c)->fd == events[i].data.fd)
+                {
+                    sim_sf_read_client(c);
+                    break;
+                }
+        }
+        /* Accept after reading, so a new client cannot take over the
+           descriptor of one removed above while its event is pending */
+        if (newClient)
+            sim_sf_check_new_client();
+#else
         fd_set rfds;
         int maxfd = -1;
         struct timeval zero;
         int ret;
 
+        if (!sim_sf_poll_due())
+            return;
+
         zero.tv_sec = zero.tv_usec = 0;
 
         FD_ZERO(&rfds);
@@ -244,6 +382,10 @@ void sim_sf_process ()
 
             sim_sf_check_clients(&rfds);
         }
+#endif
+        /* Keep polling on every call while there is traffic */
+        if (ret > 0)
+            memset(&sim_sf_next_poll, 0, sizeof sim_sf_next_poll);
 }
 
 int sim_sf_saferead(int fd, void *buffer, int count)
@@ -55,6 +55,8 @@ void sim_sf_forward_packet(const void *packet, int len);
 void sim_sf_dispatch_packet(const void *packet, int len);
 void sim_sf_open_server_socket(int port);
 void sim_sf_process ();
+void sim_sf_set_poll_interval(long usec);
+int sim_sf_poll_due(void);
 
 int sim_sf_unix_check(const char *msg, int result);
 void *sim_sf_xmalloc(size_t s);
@@ -63,6 +65,7 @@ void sim_sf_pstatus(void);
 void sim_sf_add_client(int fd);
 void sim_sf_rem_client(struct sim_sf_client_list **c);
 void sim_sf_new_client(int fd);
+int sim_sf_read_client(struct sim_sf_client_list **c);
 void sim_sf_check_clients(fd_set *fds);
 void sim_sf_wait_clients(fd_set *fds, int *maxfd);
 void sim_sf_check_new_client(void);
@@ -73,6 +76,7 @@ int sim_sf_open_source(const char *host, int port);
 int sim_sf_init_source(int fd);
 void *sim_sf_read_packet(int fd, int *len);
 int sim_sf_write_packet(int fd, const void *packet, int len);
+int sim_sf_write_dispatch(int fd, const void *packet, int len);
 
 #ifdef __cplusplus
 }
@@ -45,6 +45,7 @@
 #include <tossim.h>
 #include <sim_tossim.h>
 #include <sim_mote.h>
+#include <sim_profile.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -58,22 +59,41 @@
 
 uint16_t TOS_NODE_ID = 1;
 
+// Module variables are named "Module.var" in the app's list and
+// "Module$var" in the symbols nido resolves.
+static char* tossim_real_name(char* name) {
+  int sLen = strlen(name);
+  char* realName = (char*)malloc(sLen + 1);
+  for (int i = 0; i <= sLen; i++) {
+    realName[i] = (name[i] == '.')? '$' : name[i];
+  }
+  return realName;
+}
+
+static void tossim_variable_type(nesc_app_t* app, char* name, char** typeStr, int* isArray) {
+  *typeStr = (char*)"";
+  *isArray = 0;
+  // Could hash this for greater efficiency,
+  // but that would either require transformation
+  // in Tossim class or a more complex typemap.
+  if (app != NULL) {
+    for (int i = 0; i < app->numVariables; i++) {
+      if(strcmp(name, app->variableNames[i]) == 0) {
+	*typeStr = app->variableTypes[i];
+	*isArray = app->variableArray[i];
+	break;
+      }
+    }
+  }
+}
+
 Variable::Variable(char* str, char* formatStr, int array, int which) {
   name = str;
   format = formatStr;
   isArray = array;
   mote = which;
   
-  int sLen = strlen(name);
-  realName = (char*)malloc(sLen + 1);
-  memcpy(realName, name, sLen + 1);
-  realName[sLen] = 0;
-
-  for (int i = 0; i < sLen; i++) {
-    if (realName[i] == '.') {
-      realName[i] = '$';
-    }
-  }
+  realName = tossim_real_name(name);
 
   //  printf("Creating %s realName: %s format: %s %s\n", name, realName, formatStr, array? "[]":"");
 
@@ -86,11 +106,9 @@ Variable::Variable(char* str, char* formatStr, int array, int which) {
     data = NULL;
     ptr = NULL;
   }
-  printf("Allocated variable %s\n", realName);
 }
 
 Variable::~Variable() {
-  printf("Freeing variable %s\n", realName);
   free(data);
   free(realName);
 }
@@ -131,6 +149,91 @@ variable_string_t Variable::getData() {
   return str;
 }
 
+Watch::Watch(char* name, char* formatStr, int isArray, int motes) {
+  void* ptr;
+  void* next;
+  size_t nextLen;
+
+  realName = tossim_real_name(name);
+  format = formatStr;
+  array = isArray;
+  numMotes = motes;
+  base = NULL;
+  len = 0;
+  step = 0;
+
+  // On failure base stays NULL and valid() is false.
+  if (sim_mote_get_variable_info(0, realName, &ptr, &len) != 0) {
+    return;
+  }
+  step = len;
+  if (numMotes > 1) {
+    sim_mote_get_variable_info(1, realName, &next, &nextLen);
+    step = (char*)next - (char*)ptr;
+    // Check the last mote too rather than assume nido's layout.
+    sim_mote_get_variable_info(numMotes - 1, realName, &next, &nextLen);
+    if (step < (ptrdiff_t)len || (char*)next != (char*)ptr + step * (numMotes - 1)) {
+      return;
+    }
+  }
+  base = (char*)ptr;
+}
+
+Watch::~Watch() {
+  free(realName);
+}
+
+bool Watch::valid() {
+  return base != NULL;
+}
+
+int Watch::motes() {
+  return numMotes;
+}
+
+int Watch::size() {
+  return len;
+}
+
+int Watch::stride() {
+  return step;
+}
+
+char* Watch::type() {
+  return format;
+}
+
+bool Watch::isArray() {
+  return array;
+}
+
+// Converts straight from the mote's memory; Variable::getData()
+// copies into a buffer first.
+variable_string_t Watch::getData(int mote) {
+  variable_string_t str;
+  if (base != NULL && mote >= 0 && mote < numMotes) {
+    str.ptr = base + step * mote;
+    str.type = format;
+    str.len = len;
+    str.isArray = array;
+  }
+  else {
+    str.ptr = (char*)"<no such variable>";
+    str.type = (char*)"<no such variable>";
+    str.len = strlen("<no such variable>");
+    str.isArray = 0;
+  }
+  return str;
+}
+
+// The memory from mote 0's entry to the end of the last mote's.
+variable_buffer_t Watch::buffer() {
+  variable_buffer_t buf;
+  buf.ptr = base;
+  buf.len = (base == NULL)? 0 : step * (numMotes - 1) + len;
+  return buf;
+}
+
 Mote::Mote(nesc_app_t* n) {
   app = n;
   varTable = create_hashtable(128, tossim_hash, tossim_hash_eq);
@@ -176,24 +279,13 @@ void Mote::setID(unsigned long val) {
 }
 
 Variable* Mote::getVariable(char* name) {
-  char* typeStr = (char*)"";
+  char* typeStr;
   int isArray;
   Variable* var;
   
   var = (Variable*)hashtable_search(varTable, name);
   if (var == NULL) {
-    // Could hash this for greater efficiency,
-    // but that would either require transformation
-    // in Tossim class or a more complex typemap.
-    if (app != NULL) {
-      for (int i = 0; i < app->numVariables; i++) {
-	if(strcmp(name, app->variableNames[i]) == 0) {
-	  typeStr = app->variableTypes[i];
-	  isArray = app->variableArray[i];
-	  break;
-	}
-      }
-    }
+    tossim_variable_type(app, name, &typeStr, &isArray);
     //  printf("Getting variable %s of type %s %s\n", name, typeStr, isArray? "[]" : "");
     var = new Variable(name, typeStr, isArray, nodeID);
     hashtable_insert(varTable, name, var);
@@ -205,6 +297,14 @@ void Mote::addNoiseTraceReading(int val) {
   sim_noise_trace_add(id(), (char)val);
 }
 
+void Mote::addNoiseTraceReadings(const char* readings, int count) {
+  sim_noise_trace_add_readings(id(), readings, count);
+}
+
+int Mote::loadNoiseTrace(char* path) {
+  return sim_noise_trace_load(id(), path);
+}
+
 void Mote::createNoiseModel() {
   sim_noise_create_model(id());
 }
@@ -213,19 +313,61 @@ int Mote::generateNoise(int when) {
   return (int)sim_noise_generate(id(), when);
 }
 
-Tossim::Tossim(nesc_app_t* n) {
+bool Mote::saveNoiseModel(char* file) {
+  return sim_noise_save_model(id(), file);
+}
+
+bool Mote::loadNoiseModel(char* file) {
+  return sim_noise_load_model(id(), file);
+}
+
+Tossim::Tossim(nesc_app_t* n, int nodes) {
   app = n;
+  motes = NULL;
+  numNodes = 0;
+  watchTable = create_hashtable(128, tossim_hash, tossim_hash_eq);
+  macModel = NULL;
+  radioModel = NULL;
+  sim_set_max_nodes(nodes);
   init();
 }
 
 Tossim::~Tossim() {
   sim_end();
+  delete macModel;
+  delete radioModel;
 }
 
 void Tossim::init() {
+  int oldNodes = numNodes;
+  Mote* broadcast = NULL;
+  int i;
+
   sim_init();
-  motes = (Mote**)malloc(sizeof(Mote*) * (TOSSIM_MAX_NODES + 1));
-  memset(motes, 0, sizeof(Mote*) * TOSSIM_MAX_NODES);
+  numNodes = sim_max_nodes();
+  // Python may hold references to the motes, so keep those whose IDs
+  // still exist and delete only the ones beyond the new capacity.
+  if (motes != NULL) {
+    broadcast = motes[oldNodes];
+    for (i = numNodes; i < oldNodes; i++) {
+      delete motes[i];
+    }
+  }
+  motes = (Mote**)realloc(motes, sizeof(Mote*) * (numNodes + 1));
+  for (i = oldNodes; i < numNodes; i++) {
+    motes[i] = NULL;
+  }
+  motes[numNodes] = broadcast;
+}
+
+int Tossim::maxNodes() {
+  return numNodes;
+}
+
+// Resizes the C state and restarts the simulation, as init() does.
+void Tossim::setMaxNodes(int nodes) {
+  sim_set_max_nodes(nodes);
+  init();
 }
 
 long long int Tossim::time() {
@@ -250,21 +392,35 @@ Mote* Tossim::currentNode() {
 }
 
 Mote* Tossim::getNode(unsigned long nodeID) {
-  if (nodeID > TOSSIM_MAX_NODES) {
-    nodeID = TOSSIM_MAX_NODES;
+  if (nodeID > (unsigned long)numNodes) {
+    nodeID = numNodes;
     // log an error, asked for an invalid node
   }
-  else {
-    if (motes[nodeID] == NULL) {
-      motes[nodeID] = new Mote(app);
-      if (nodeID == TOSSIM_MAX_NODES) {
-	motes[nodeID]->setID(0xffff);
-      }
-      else {
-	motes[nodeID]->setID(nodeID);
-      }
+  if (motes[nodeID] == NULL) {
+    motes[nodeID] = new Mote(app);
+    if (nodeID == (unsigned long)numNodes) {
+      motes[nodeID]->setID(0xffff);
+    }
+    else {
+      motes[nodeID]->setID(nodeID);
+    }
+  }
+  return motes[nodeID];
+}
+
+// times[i] is node i's boot time; nodes with a negative time are
+// left alone. Unlike getNode(i)->bootAtTime(), this does not create
+// a Mote object per node.
+void Tossim::bootAtTimes(const long long int* times, int count) {
+  int i;
+  if (count > numNodes) {
+    count = numNodes;
+  }
+  for (i = 0; i < count; i++) {
+    if (times[i] >= 0) {
+      sim_mote_set_start_time(i, times[i]);
+      sim_mote_enqueue_boot_event(i);
     }
-    return motes[nodeID];
   }
 }
 
@@ -280,20 +436,151 @@ bool Tossim::removeChannel(char* channel, FILE* file) {
   return sim_remove_channel(channel, file);
 }
 
+bool Tossim::openTrace(char* path) {
+  return sim_open_trace(path);
+}
+
+void Tossim::closeTrace() {
+  sim_close_trace();
+}
+
+void Tossim::addTraceChannel(char* channel) {
+  sim_add_trace_channel(channel);
+}
+
+bool Tossim::removeTraceChannel(char* channel) {
+  return sim_remove_trace_channel(channel);
+}
+
 void Tossim::randomSeed(int seed) {
   return sim_random_seed(seed);
 }
 
 bool Tossim::runNextEvent() {
-  return sim_run_next_event();
+  bool result = sim_run_next_event();
+  sim_flush_channels();
+  return result;
+}
+
+long long int Tossim::runUntil(long long int time) {
+  return sim_run_until(time);
+}
+
+long long int Tossim::runFor(long long int ticks) {
+  return sim_run_until(sim_time() + ticks);
+}
+
+long long int Tossim::runEvents(long long int count) {
+  return sim_run_events(count);
+}
+
+void Tossim::setPace(double speed, long long int quantum) {
+  sim_set_pace(speed, quantum);
+}
+
+long long int Tossim::paceSleeps() {
+  return sim_pace_sleep_count();
+}
+
+double Tossim::paceSleepTime() {
+  return sim_pace_sleep_time();
+}
+
+double Tossim::paceLag() {
+  return sim_pace_lag_time();
+}
+
+double Tossim::paceMaxLag() {
+  return sim_pace_max_lag_time();
+}
+
+int Tossim::fork() {
+  return sim_fork();
 }
 
+void Tossim::endBranch(int status) {
+  sim_end_branch(status);
+}
+
+int Tossim::queueSize() {
+  return sim_queue_size();
+}
+
+long long int Tossim::queueRemovedCount() {
+  return sim_queue_removed_count();
+}
+
+long long int Tossim::queueTombstoneCount() {
+  return sim_queue_tombstone_count();
+}
+
+long long int Tossim::poolAllocations() {
+  return sim_pool_allocations();
+}
+
+long long int Tossim::poolInUse() {
+  return sim_pool_in_use();
+}
+
+long long int Tossim::poolPeakInUse() {
+  return sim_pool_peak_in_use();
+}
+
+long long int Tossim::poolSystemAllocations() {
+  return sim_pool_system_allocations();
+}
+
+long long int Tossim::poolReservedBytes() {
+  return sim_pool_reserved_bytes();
+}
+
+void Tossim::setProfiling(bool enable) {
+  sim_profile_enable(enable);
+}
+
+bool Tossim::profiling() {
+  return sim_profile_enabled();
+}
+
+void Tossim::resetStats() {
+  sim_profile_reset();
+}
+
+char* Tossim::statsJson() {
+  return sim_profile_json();
+}
+
+Watch* Tossim::watch(char* name) {
+  char* typeStr;
+  int isArray;
+  Watch* w = (Watch*)hashtable_search(watchTable, name);
+  if (w == NULL) {
+    tossim_variable_type(app, name, &typeStr, &isArray);
+    w = new Watch(name, typeStr, isArray, numNodes);
+    if (!w->valid()) {
+      delete w;
+      return NULL;
+    }
+    // The key must outlive the Python string it came from.
+    hashtable_insert(watchTable, strdup(name), w);
+  }
+  return w;
+}
+
+// MAC and Radio hold no state of their own (they set the C globals),
+// so every caller can share one of each.
 MAC* Tossim::mac() {
-  return new MAC();
+  if (macModel == NULL) {
+    macModel = new MAC();
+  }
+  return macModel;
 }
 
 Radio* Tossim::radio() {
-  return new Radio();
+  if (radioModel == NULL) {
+    radioModel = new Radio();
+  }
+  return radioModel;
 }
 
 Packet* Tossim::newPacket() {
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Implementation of the dBm/mW conversions. See sim_dbm.h.
+ *
+ * @date   Oct 18 2026
+ */
+
+#include <math.h>
+#include <sim_dbm.h>
+
+static double dbmTable[SIM_DBM_TABLE_MAX - SIM_DBM_TABLE_MIN + 1];
+static int dbmTableReady = 0;
+
+static void sim_dbm_fill_table() {
+  int i;
+  for (i = SIM_DBM_TABLE_MIN; i <= SIM_DBM_TABLE_MAX; i++) {
+    dbmTable[i - SIM_DBM_TABLE_MIN] = pow(10.0, (double)i / 10.0);
+  }
+  dbmTableReady = 1;
+}
+
+double sim_dbm_to_mw(double dbm) {
+  // Check the range before converting, as converting an out of
+  // range double to an int is undefined.
+  if (dbm >= SIM_DBM_TABLE_MIN && dbm <= SIM_DBM_TABLE_MAX) {
+    int i = (int)dbm;
+    if (i == dbm) {
+      if (!dbmTableReady) {
+	sim_dbm_fill_table();
+      }
+      return dbmTable[i - SIM_DBM_TABLE_MIN];
+    }
+  }
+  return pow(10.0, dbm / 10.0);
+}
+
+double sim_mw_to_dbm(double mw) {
+  return 10.0 * log(mw) / log(10.0);
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Conversions between dBm and mW for the radio models.
+ *
+ * Signal strengths are kept in dBm, but interference has to be added
+ * up in the linear domain. sim_dbm_to_mw() serves integral dBm values
+ * in [SIM_DBM_TABLE_MIN, SIM_DBM_TABLE_MAX], which is every value the
+ * CPM noise model produces, from a table filled in with pow() the
+ * first time it is used; other values fall back to pow(). Both
+ * functions return exactly what the pow()/log() expressions they
+ * replace do.
+ *
+ * @date   Oct 18 2026
+ */
+
+#ifndef SIM_DBM_H_INCLUDED
+#define SIM_DBM_H_INCLUDED
+
+#define SIM_DBM_TABLE_MIN (-128)
+#define SIM_DBM_TABLE_MAX 127
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+double sim_dbm_to_mw(double dbm);
+double sim_mw_to_dbm(double mw);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_DBM_H_INCLUDED
@@ -39,34 +39,139 @@
 
 
 #include <heap.h>
+#include <calendar.h>
 #include <sim_event_queue.h>
+#include <sim_profile.h>
 
+// By default the queue is a binary heap. Compiling with
+// -DTOSSIM_CALENDAR_QUEUE selects a calendar queue, which has O(1)
+// amortized insert and pop; it is faster for large networks with
+// many pending events.
+#ifdef TOSSIM_CALENDAR_QUEUE
+static calendar_t eventHeap;
+#define sim_queue_backend_init       init_calendar
+#define sim_queue_backend_insert     calendar_insert
+#define sim_queue_backend_pop        calendar_pop_min_data
+#define sim_queue_backend_is_empty   calendar_is_empty
+#define sim_queue_backend_min_key    calendar_get_min_key
+#define sim_queue_backend_size       calendar_size
+#else
 static heap_t eventHeap;
+#define sim_queue_backend_init       init_heap
+#define sim_queue_backend_insert     heap_insert
+#define sim_queue_backend_pop        heap_pop_min_data
+#define sim_queue_backend_is_empty   heap_is_empty
+#define sim_queue_backend_min_key    heap_get_min_key
+#define sim_queue_backend_size       heap_size
+#endif
+
+// Events taken out by sim_queue_remove() before reaching the head of
+// the queue, and cancelled events that reached it anyway (because
+// they were not in the queue when they were cancelled).
+static long long int queueRemoved;
+static long long int queueTombstones;
+
+#ifndef TOSSIM_CALENDAR_QUEUE
+static void sim_queue_moved(void* data, int index) {
+  ((sim_event_t*)data)->index = index;
+}
+#endif
 
 void sim_queue_init() __attribute__ ((C, spontaneous)) {
-  init_heap(&eventHeap);
+  sim_queue_backend_init(&eventHeap);
+#ifndef TOSSIM_CALENDAR_QUEUE
+  eventHeap.moved = sim_queue_moved;
+#endif
+  queueRemoved = 0;
+  queueTombstones = 0;
 }
 
+// One line per operation on the "QueueTrace" channel, for replay by
+// bench/queue-bench. It is on the two hottest paths in the simulator,
+// so it is compiled in only with -DTOSSIM_QUEUE_TRACE.
+#ifdef TOSSIM_QUEUE_TRACE
+#define sim_queue_trace(...) dbg_clear("QueueTrace", __VA_ARGS__)
+#else
+#define sim_queue_trace(...)
+#endif
+
 void sim_queue_insert(sim_event_t* event) __attribute__ ((C, spontaneous)) {
   dbg("Queue", "Inserting 0x%p\n", event);
-  heap_insert(&eventHeap, event, event->time);
+  sim_queue_trace("i %lli\n", event->time - sim_time());
+  // The heap keeps index up to date; the calendar queue finds
+  // events by time, so index only marks that the event is queued.
+  event->index = 0;
+  sim_queue_backend_insert(&eventHeap, event, event->time);
 }
 
 sim_event_t* sim_queue_pop() __attribute__ ((C, spontaneous)) {
   long long int key;
-  return (sim_event_t*)(heap_pop_min_data(&eventHeap, &key));
+  sim_event_t* event;
+  sim_queue_trace("p\n");
+  event = (sim_event_t*)(sim_queue_backend_pop(&eventHeap, &key));
+  event->index = -1;
+  if (event->cancelled) {
+    queueTombstones++;
+  }
+  return event;
+}
+
+bool sim_queue_remove(sim_event_t* event) __attribute__ ((C, spontaneous)) {
+  // Events that were never queued, have already been popped, or were
+  // zeroed by a reboot (index 0) fail these checks.
+  if (event->index < 0) {
+    return FALSE;
+  }
+#ifdef TOSSIM_CALENDAR_QUEUE
+  if (!calendar_remove(&eventHeap, event, event->time)) {
+    return FALSE;
+  }
+#else
+  if (heap_get_data(&eventHeap, event->index) != event) {
+    return FALSE;
+  }
+  heap_remove(&eventHeap, event->index);
+#endif
+  dbg("Queue", "Removed 0x%p\n", event);
+  event->index = -1;
+  queueRemoved++;
+  return TRUE;
+}
+
+void sim_queue_cancel(sim_event_t* event) __attribute__ ((C, spontaneous)) {
+  event->cancelled = TRUE;
+  if (sim_queue_remove(event)) {
+    if (sim_profile_on) {
+      sim_profile_cancelled(event);
+    }
+    if (event->cleanup != NULL) {
+      event->cleanup(event);
+    }
+  }
+}
+
+int sim_queue_size() __attribute__ ((C, spontaneous)) {
+  return sim_queue_backend_size(&eventHeap);
+}
+
+long long int sim_queue_removed_count() __attribute__ ((C, spontaneous)) {
+  return queueRemoved;
+}
+
+long long int sim_queue_tombstone_count() __attribute__ ((C, spontaneous)) {
+  return queueTombstones;
 }
 
 bool sim_queue_is_empty() __attribute__ ((C, spontaneous)) {
-  return heap_is_empty(&eventHeap);
+  return sim_queue_backend_is_empty(&eventHeap);
 }
 
 long long int sim_queue_peek_time() __attribute__ ((C, spontaneous)) {
-  if (heap_is_empty(&eventHeap)) {
+  if (sim_queue_backend_is_empty(&eventHeap)) {
     return -1;
   }
   else {
-    return heap_get_min_key(&eventHeap);
+    return sim_queue_backend_min_key(&eventHeap);
   }
 }
 
@@ -78,7 +183,7 @@ void sim_queue_cleanup_none(sim_event_t* event) __attribute__ ((C, spontaneous))
 
 void sim_queue_cleanup_event(sim_event_t* event) __attribute__ ((C, spontaneous)) {
   dbg("Queue", "cleanup_event: 0x%p\n", event);
-  free(event);
+  sim_pool_free(event, sizeof(sim_event_t));
 }
 
 void sim_queue_cleanup_data(sim_event_t* event) __attribute__ ((C, spontaneous)) {
@@ -91,12 +196,13 @@ void sim_queue_cleanup_total(sim_event_t* event) __attribute__ ((C, spontaneous)
   dbg("Queue", "cleanup_total: 0x%p\n", event);
   free (event->data);
   event->data = NULL;
-  free (event);
+  sim_pool_free(event, sizeof(sim_event_t));
 }
 
 sim_event_t* sim_queue_allocate_event() {
-  sim_event_t* evt = (sim_event_t*)malloc(sizeof(sim_event_t));
+  sim_event_t* evt = (sim_event_t*)sim_pool_alloc(sizeof(sim_event_t));
   memset(evt, 0, sizeof(sim_event_t));
   evt->mote = sim_node();
+  evt->index = -1;
   return evt;
 }
@@ -37,6 +37,10 @@
  * functionality like packet injection/reception from external tools
  * is on the Python side.
  *
+ * Events scheduled for the same time run in the order they were
+ * inserted, so two runs with the same random seed execute exactly
+ * the same event sequence.
+ *
  * @author Phil Levis
  * @date   November 22 2005
  */
@@ -56,12 +60,20 @@ struct sim_event {
   bool force; // Whether this event type should always be executed
             // even if a mote is "turned off"
   bool cancelled; // Whether this event has been cancelled
+  int index;      // Position in the queue, or -1 if not queued
   void* data;
   
   void (*handle)(sim_event_t* e);
   void (*cleanup)(sim_event_t* e);
 };
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Events come from the simulator's pool (sim_pool.h). An event
+// whose cleanup is sim_queue_cleanup_event or sim_queue_cleanup_total
+// must be allocated with this function, not malloc().
 sim_event_t* sim_queue_allocate_event();
 
 void sim_queue_init();
@@ -70,10 +82,25 @@ bool sim_queue_is_empty();
 long long int sim_queue_peek_time();
 sim_event_t* sim_queue_pop();
 
+// Take an event out of the queue without running it. Returns FALSE
+// if the event was not in the queue (e.g., it is currently running).
+bool sim_queue_remove(sim_event_t* event);
+// Mark an event cancelled and, if it is still queued, remove it and
+// run its cleanup function. An event that is not queued stays marked
+// cancelled, so a handler that reinserts it can check the flag.
+void sim_queue_cancel(sim_event_t* event);
+
+int sim_queue_size();
+long long int sim_queue_removed_count();
+long long int sim_queue_tombstone_count();
+
 void sim_queue_cleanup_none(sim_event_t* e);
 void sim_queue_cleanup_event(sim_event_t* e);
 void sim_queue_cleanup_data(sim_event_t* e) ;
 void sim_queue_cleanup_total(sim_event_t* e);
 
+#ifdef __cplusplus
+}
+#endif
 
 #endif // EVENT_QUEUE_H_INCLUDED
@@ -1,4 +1,5 @@
 #include <sim_gain.h>
+#include <limits.h>
 
 typedef struct sim_gain_noise {
   double mean;
@@ -6,48 +7,175 @@ typedef struct sim_gain_noise {
 } sim_gain_noise_t;
 
 
-gain_entry_t* connectivity[TOSSIM_MAX_NODES + 1];
-sim_gain_noise_t localNoise[TOSSIM_MAX_NODES + 1];
+// Links out of each node: count entries followed by a sentinel
+// entry whose mote is -1, which is how sim_gain_next() finds the end.
+typedef struct sim_gain_row {
+  int count;
+  int size;
+  int bulkStart;  // First link appended by a bulk load, or -1
+  gain_entry_t* entries;
+} sim_gain_row_t;
+
+// Per-node scratch for bulk loads. A slot holds a value only while
+// its mark equals stampGen, so starting a new map costs nothing.
+typedef struct sim_gain_stamp {
+  int mark;
+  int index;
+  double value;
+} sim_gain_stamp_t;
+
+// A link of a row touched by a bulk load, keyed by the row of its
+// destination.
+typedef struct sim_gain_pair {
+  int destRow;
+  int src;
+  int index;
+} sim_gain_pair_t;
+
+// One row per node plus a last row shared by every node at or past
+// gainNodes. Allocated by sim_gain_init() from sim_max_nodes().
+sim_gain_row_t* connectivity = NULL;
+sim_gain_noise_t* localNoise = NULL;
+int gainNodes = 0;
 double sensitivity = 4.0;
 
-gain_entry_t* sim_gain_allocate_link(int mote);
-void sim_gain_deallocate_link(gain_entry_t* linkToDelete);
+static sim_gain_stamp_t* stampFwd = NULL;
+static sim_gain_stamp_t* stampBack = NULL;
+static int stampGen = 0;
+static int* bulkRows = NULL;
+static int bulkRowCount = 0;
+static int bulkRowSize = 0;
+static sim_gain_pair_t* bulkPairs = NULL;
+static int bulkPairSize = 0;
+
+#ifdef TOSSIM_GAIN_MATRIX
+double* gainMatrix = NULL;
+bool* gainMatrixLinked = NULL;
+#define sim_gain_in_matrix(src, dest) ((src) >= 0 && (dest) >= 0 && (src) <= gainNodes && (dest) <= gainNodes)
+#define sim_gain_matrix_index(src, dest) ((src) * (gainNodes + 1) + (dest))
+#endif
+
+static inline int sim_gain_row_index(int node) {
+  if (node > gainNodes) {
+    return gainNodes;
+  }
+  return node;
+}
+
+// Size the tables for nodes 0..nodes-1. Links and noise floors are
+// kept across calls with the same size, as they were when the tables
+// were static; changing the size discards them.
+void sim_gain_init(int nodes) __attribute__ ((C, spontaneous)) {
+  int i;
+  if (connectivity != NULL && nodes == gainNodes) {
+    return;
+  }
+  if (connectivity != NULL) {
+    for (i = 0; i <= gainNodes; i++) {
+      free(connectivity[i].entries);
+    }
+  }
+  free(connectivity);
+  free(localNoise);
+  free(stampFwd);
+  free(stampBack);
+  gainNodes = nodes;
+  connectivity = (sim_gain_row_t*)calloc(nodes + 1, sizeof(sim_gain_row_t));
+  localNoise = (sim_gain_noise_t*)calloc(nodes + 1, sizeof(sim_gain_noise_t));
+  stampFwd = (sim_gain_stamp_t*)calloc(nodes + 1, sizeof(sim_gain_stamp_t));
+  stampBack = (sim_gain_stamp_t*)calloc(nodes + 1, sizeof(sim_gain_stamp_t));
+  stampGen = 0;
+  for (i = 0; i <= nodes; i++) {
+    connectivity[i].bulkStart = -1;
+  }
+#ifdef TOSSIM_GAIN_MATRIX
+  free(gainMatrix);
+  free(gainMatrixLinked);
+  gainMatrix = (double*)calloc((size_t)(nodes + 1) * (nodes + 1), sizeof(double));
+  gainMatrixLinked = (bool*)calloc((size_t)(nodes + 1) * (nodes + 1), sizeof(bool));
+#endif
+}
+
+static gain_entry_t* sim_gain_find(int src, int dest) {
+  sim_gain_row_t* row = &connectivity[sim_gain_row_index(src)];
+  int i;
+  for (i = 0; i < row->count; i++) {
+    if (row->entries[i].mote == dest) {
+      return &row->entries[i];
+    }
+  }
+  return NULL;
+}
+
+// The link from src to dest changed: update the reverseGain cached
+// by dest's links back to src. Like sim_gain_value(), nodes past
+// gainNodes share the last row.
+static void sim_gain_set_reverse(int src, int dest, double gain) {
+  sim_gain_row_t* row;
+  int i;
+  if (dest < 0) {
+    return;
+  }
+  row = &connectivity[sim_gain_row_index(dest)];
+  for (i = 0; i < row->count; i++) {
+    if (sim_gain_row_index(row->entries[i].mote) == src) {
+      row->entries[i].reverseGain = gain;
+    }
+  }
+}
 
 gain_entry_t* sim_gain_first(int src) __attribute__ ((C, spontaneous)) {
-  if (src > TOSSIM_MAX_NODES) {
-    return connectivity[TOSSIM_MAX_NODES];
-  } 
-  return connectivity[src];
+  sim_gain_row_t* row = &connectivity[sim_gain_row_index(src)];
+  if (row->count == 0) {
+    return NULL;
+  }
+  return row->entries;
 }
 
 gain_entry_t* sim_gain_next(gain_entry_t* currentLink) __attribute__ ((C, spontaneous)) {
-  return currentLink->next;
+  currentLink++;
+  if (currentLink->mote < 0) {
+    return NULL;
+  }
+  return currentLink;
 }
 
 void sim_gain_add(int src, int dest, double gain) __attribute__ ((C, spontaneous))  {
   gain_entry_t* current;
   int temp = sim_node();
-  if (src > TOSSIM_MAX_NODES) {
-    src = TOSSIM_MAX_NODES;
+  if (src > gainNodes) {
+    src = gainNodes;
   }
   sim_set_node(src);
 
-  current = sim_gain_first(src);
-  while (current != NULL) {
-    if (current->mote == dest) {
-      sim_set_node(temp);
-      break;
-    }
-    current = current->next;
-  }
-
+  current = sim_gain_find(src, dest);
   if (current == NULL) {
-    current = sim_gain_allocate_link(dest);
-    current->next = connectivity[src];
-    connectivity[src] = current;
+    sim_gain_row_t* row = &connectivity[src];
+    gain_entry_t* reverse = sim_gain_find(dest, src);
+    double reverseGain = (reverse != NULL)? reverse->gain : 1.0;
+    if (row->count == row->size) {
+      row->size = (row->size == 0)? 4 : row->size * 2;
+      row->entries = (gain_entry_t*)realloc(row->entries, sizeof(gain_entry_t) * (row->size + 1));
+      if (row->count == 0) {
+	row->entries[0].mote = -1;
+      }
+    }
+    // Newest link first, as the linked lists did, so broadcasts
+    // reach neighbors in the same order.
+    memmove(&row->entries[1], &row->entries[0], sizeof(gain_entry_t) * (row->count + 1));
+    row->count++;
+    current = &row->entries[0];
+    current->mote = dest;
+    current->reverseGain = reverseGain;
   }
-  current->mote = dest;
   current->gain = gain;
+  sim_gain_set_reverse(src, dest, gain);
+#ifdef TOSSIM_GAIN_MATRIX
+  if (sim_gain_in_matrix(src, dest)) {
+    gainMatrix[sim_gain_matrix_index(src, dest)] = gain;
+    gainMatrixLinked[sim_gain_matrix_index(src, dest)] = TRUE;
+  }
+#endif
   dbg("Gain", "Adding link from %i to %i with gain %f\n", src, dest, gain);
   sim_set_node(temp);
 }
@@ -56,89 +184,315 @@ double sim_gain_value(int src, int dest) __attribute__ ((C, spontaneous))  {
   gain_entry_t* current;
   int temp = sim_node();
   sim_set_node(src);
-  current = sim_gain_first(src);
-  while (current != NULL) {
-    if (current->mote == dest) {
+#ifdef TOSSIM_GAIN_MATRIX
+  if (sim_gain_in_matrix(src, dest)) {
+    if (gainMatrixLinked[sim_gain_matrix_index(src, dest)]) {
       sim_set_node(temp);
-      dbg("Gain", "Getting link from %i to %i with gain %f\n", src, dest, current->gain);
-      return current->gain;
+      dbg("Gain", "Getting link from %i to %i with gain %f\n", src, dest, gainMatrix[sim_gain_matrix_index(src, dest)]);
+      return gainMatrix[sim_gain_matrix_index(src, dest)];
     }
-    current = current->next;
+    sim_set_node(temp);
+    dbg("Gain", "Getting default link from %i to %i with gain %f\n", src, dest, 1.0);
+    return 1.0;
   }
+#endif
+  current = sim_gain_find(src, dest);
   sim_set_node(temp);
+  if (current != NULL) {
+    dbg("Gain", "Getting link from %i to %i with gain %f\n", src, dest, current->gain);
+    return current->gain;
+  }
   dbg("Gain", "Getting default link from %i to %i with gain %f\n", src, dest, 1.0);
   return 1.0;
 }
 
 bool sim_gain_connected(int src, int dest) __attribute__ ((C, spontaneous)) {
-  gain_entry_t* current;
-  int temp = sim_node();
-  sim_set_node(src);
-  current = sim_gain_first(src);
-  while (current != NULL) {
-    if (current->mote == dest) {
-      sim_set_node(temp);
-      return TRUE;
-    }
-    current = current->next;
+#ifdef TOSSIM_GAIN_MATRIX
+  if (sim_gain_in_matrix(src, dest)) {
+    return gainMatrixLinked[sim_gain_matrix_index(src, dest)];
   }
-  sim_set_node(temp);
-  return FALSE;
+#endif
+  return sim_gain_find(src, dest) != NULL;
 }
   
 void sim_gain_remove(int src, int dest) __attribute__ ((C, spontaneous))  {
   gain_entry_t* current;
-  gain_entry_t* prevLink;
   int temp = sim_node();
   
-  if (src > TOSSIM_MAX_NODES) {
-    src = TOSSIM_MAX_NODES;
+  if (src > gainNodes) {
+    src = gainNodes;
   }
 
   sim_set_node(src);
     
-  current = sim_gain_first(src);
-  prevLink = NULL;
-    
-  while (current != NULL) {
-    gain_entry_t* tmp;
-    if (current->mote == dest) {
-      if (prevLink == NULL) {
-	connectivity[src] = current->next;
+  current = sim_gain_find(src, dest);
+  if (current != NULL) {
+    sim_gain_row_t* row = &connectivity[src];
+    int i = current - row->entries;
+    // Shift the later links and the sentinel down over this one
+    memmove(current, current + 1, sizeof(gain_entry_t) * (row->count - i));
+    row->count--;
+    sim_gain_set_reverse(src, dest, 1.0);
+#ifdef TOSSIM_GAIN_MATRIX
+    if (sim_gain_in_matrix(src, dest)) {
+      gainMatrixLinked[sim_gain_matrix_index(src, dest)] = FALSE;
+    }
+#endif
+  }
+  sim_set_node(temp);
+}
+
+// Bulk loads. sim_gain_add() searches the row, shifts it to keep the
+// newest link first and rescans the reverse row for every link, which
+// is quadratic in the degree when a whole topology is loaded. A bulk
+// load instead appends each link to its row and then, once per batch,
+// merges repeated links, restores the newest-first order and fixes
+// the reverse gains.
+
+// Start a new set of stamps in stampFwd and stampBack.
+static void sim_gain_stamp_next() {
+  if (++stampGen == INT_MAX) {
+    memset(stampFwd, 0, sizeof(sim_gain_stamp_t) * (gainNodes + 1));
+    memset(stampBack, 0, sizeof(sim_gain_stamp_t) * (gainNodes + 1));
+    stampGen = 1;
+  }
+}
+
+static void sim_gain_bulk_add(int src, int dest, double gain) {
+  sim_gain_row_t* row;
+  gain_entry_t* entry;
+  int temp = sim_node();
+  if (src > gainNodes) {
+    src = gainNodes;
+  }
+  sim_set_node(src);
+
+  row = &connectivity[src];
+  if (row->bulkStart < 0) {
+    if (bulkRowCount == bulkRowSize) {
+      bulkRowSize = (bulkRowSize == 0)? 16 : bulkRowSize * 2;
+      bulkRows = (int*)realloc(bulkRows, sizeof(int) * bulkRowSize);
+    }
+    bulkRows[bulkRowCount++] = src;
+    row->bulkStart = row->count;
+  }
+  if (row->count == row->size) {
+    row->size = (row->size == 0)? 4 : row->size * 2;
+    row->entries = (gain_entry_t*)realloc(row->entries, sizeof(gain_entry_t) * (row->size + 1));
+  }
+  entry = &row->entries[row->count++];
+  entry->mote = dest;
+  entry->gain = gain;
+  entry->reverseGain = 1.0;
+  row->entries[row->count].mote = -1;
+#ifdef TOSSIM_GAIN_MATRIX
+  if (sim_gain_in_matrix(src, dest)) {
+    gainMatrix[sim_gain_matrix_index(src, dest)] = gain;
+    gainMatrixLinked[sim_gain_matrix_index(src, dest)] = TRUE;
+  }
+#endif
+  dbg("Gain", "Adding link from %i to %i with gain %f\n", src, dest, gain);
+  sim_set_node(temp);
+}
+
+static void sim_gain_reverse_entries(gain_entry_t* entries, int count) {
+  int i;
+  for (i = 0; i < count / 2; i++) {
+    gain_entry_t tmp = entries[i];
+    entries[i] = entries[count - 1 - i];
+    entries[count - 1 - i] = tmp;
+  }
+}
+
+// The link to mote among the first count entries of row, or -1.
+// stampFwd maps the in-range motes to their indices.
+static int sim_gain_bulk_lookup(sim_gain_row_t* row, int count, int mote) {
+  int i;
+  if (mote >= 0 && mote <= gainNodes) {
+    return (stampFwd[mote].mark == stampGen)? stampFwd[mote].index : -1;
+  }
+  for (i = 0; i < count; i++) {
+    if (row->entries[i].mote == mote) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Fold the links appended to row into it, as if each had been added
+// with sim_gain_add(): a repeated link keeps its place and takes the
+// last gain, and new links go in front, newest first.
+static void sim_gain_bulk_merge(sim_gain_row_t* row) {
+  int start = row->bulkStart;
+  int i, count;
+
+  sim_gain_stamp_next();
+  for (i = 0; i < start; i++) {
+    int mote = row->entries[i].mote;
+    if (mote >= 0 && mote <= gainNodes) {
+      stampFwd[mote].mark = stampGen;
+      stampFwd[mote].index = i;
+    }
+  }
+  count = start;
+  for (i = start; i < row->count; i++) {
+    gain_entry_t* entry = &row->entries[i];
+    int index = sim_gain_bulk_lookup(row, count, entry->mote);
+    if (index >= 0) {
+      row->entries[index].gain = entry->gain;
+      continue;
+    }
+    row->entries[count] = *entry;
+    if (entry->mote >= 0 && entry->mote <= gainNodes) {
+      stampFwd[entry->mote].mark = stampGen;
+      stampFwd[entry->mote].index = count;
+    }
+    count++;
+  }
+  row->count = count;
+  row->entries[count].mote = -1;
+  row->bulkStart = -1;
+  sim_gain_reverse_entries(row->entries, count);
+  sim_gain_reverse_entries(row->entries + (count - start), start);
+}
+
+static int sim_gain_pair_compare(const void* a, const void* b) {
+  return ((const sim_gain_pair_t*)a)->destRow - ((const sim_gain_pair_t*)b)->destRow;
+}
+
+// Every link of a touched row needs the gain back from its
+// destination, and every link into a touched row from that
+// destination needs the new gain. Grouping the touched links by
+// destination row lets one pass over each such row do both.
+static void sim_gain_bulk_reverse() {
+  int pairCount = 0;
+  int i, j, k;
+
+  for (i = 0; i < bulkRowCount; i++) {
+    pairCount += connectivity[bulkRows[i]].count;
+  }
+  if (pairCount > bulkPairSize) {
+    bulkPairSize = pairCount;
+    bulkPairs = (sim_gain_pair_t*)realloc(bulkPairs, sizeof(sim_gain_pair_t) * bulkPairSize);
+  }
+  pairCount = 0;
+  for (i = 0; i < bulkRowCount; i++) {
+    sim_gain_row_t* row = &connectivity[bulkRows[i]];
+    for (j = 0; j < row->count; j++) {
+      if (row->entries[j].mote < 0) {
+	continue;
       }
-      else {
-	prevLink->next = current->next;
+      bulkPairs[pairCount].destRow = sim_gain_row_index(row->entries[j].mote);
+      bulkPairs[pairCount].src = bulkRows[i];
+      bulkPairs[pairCount].index = j;
+      pairCount++;
+    }
+  }
+  qsort(bulkPairs, pairCount, sizeof(sim_gain_pair_t), sim_gain_pair_compare);
+
+  for (i = 0; i < pairCount; i = k) {
+    int dest = bulkPairs[i].destRow;
+    sim_gain_row_t* destRow = &connectivity[dest];
+
+    // stampFwd: gains out of dest, by mote.
+    // stampBack: gains into dest, by the row they come from.
+    sim_gain_stamp_next();
+    for (j = 0; j < destRow->count; j++) {
+      int mote = destRow->entries[j].mote;
+      if (mote >= 0 && mote <= gainNodes) {
+	stampFwd[mote].mark = stampGen;
+	stampFwd[mote].value = destRow->entries[j].gain;
       }
-      tmp = current->next;
-      sim_gain_deallocate_link(current);
-      current = tmp;
     }
-    else {
-      prevLink = current;
-      current = current->next;
+    for (k = i; k < pairCount && bulkPairs[k].destRow == dest; k++) {
+      int src = bulkPairs[k].src;
+      gain_entry_t* entry = &connectivity[src].entries[bulkPairs[k].index];
+      entry->reverseGain = (stampFwd[src].mark == stampGen)? stampFwd[src].value : 1.0;
+      if (entry->mote == dest) {
+	stampBack[src].mark = stampGen;
+	stampBack[src].value = entry->gain;
+      }
+    }
+    for (j = 0; j < destRow->count; j++) {
+      int src = sim_gain_row_index(destRow->entries[j].mote);
+      if (src >= 0 && stampBack[src].mark == stampGen) {
+	destRow->entries[j].reverseGain = stampBack[src].value;
+      }
     }
   }
-  sim_set_node(temp);
+}
+
+static void sim_gain_bulk_end() {
+  int i;
+  for (i = 0; i < bulkRowCount; i++) {
+    sim_gain_bulk_merge(&connectivity[bulkRows[i]]);
+  }
+  sim_gain_bulk_reverse();
+  bulkRowCount = 0;
+}
+
+// Links as (src, dest, gain) triples.
+void sim_gain_add_links(const double* links, int count) __attribute__ ((C, spontaneous)) {
+  int i;
+  for (i = 0; i < count; i++) {
+    sim_gain_bulk_add((int)links[3 * i], (int)links[3 * i + 1], links[3 * i + 2]);
+  }
+  sim_gain_bulk_end();
+}
+
+// Apply a gain file as written by the LinkLayerModel tool: lines of
+// "gain src dest dBm" and "noise node mean range". Other lines are
+// skipped. Returns the number of lines applied, or -1 if the file
+// cannot be opened.
+int sim_gain_load_file(const char* path) __attribute__ ((C, spontaneous)) {
+  FILE* file = fopen(path, "r");
+  char line[256];
+  int count = 0;
+  if (file == NULL) {
+    dbgerror("TOSSIM", "Could not open gain file %s.\n", path);
+    return -1;
+  }
+  while (fgets(line, sizeof(line), file) != NULL) {
+    char* pos = line;
+    int a, b;
+    double x, y;
+    while (*pos == ' ' || *pos == '\t') {
+      pos++;
+    }
+    if (strncmp(pos, "gain", 4) == 0 &&
+	sscanf(pos + 4, "%i %i %lf", &a, &b, &x) == 3) {
+      sim_gain_bulk_add(a, b, x);
+      count++;
+    }
+    else if (strncmp(pos, "noise", 5) == 0 &&
+	     sscanf(pos + 5, "%i %lf %lf", &a, &x, &y) == 3) {
+      sim_gain_set_noise_floor(a, x, y);
+      count++;
+    }
+  }
+  sim_gain_bulk_end();
+  fclose(file);
+  return count;
 }
 
 void sim_gain_set_noise_floor(int node, double mean, double range) __attribute__ ((C, spontaneous))  {
-  if (node > TOSSIM_MAX_NODES) {
-    node = TOSSIM_MAX_NODES;
+  if (node > gainNodes) {
+    node = gainNodes;
   }
   localNoise[node].mean = mean;
   localNoise[node].range = range;
 }
 
 double sim_gain_noise_mean(int node) {
-  if (node > TOSSIM_MAX_NODES) {
-    node = TOSSIM_MAX_NODES;
+  if (node > gainNodes) {
+    node = gainNodes;
   }
   return localNoise[node].mean;
 }
 
 double sim_gain_noise_range(int node) {
-  if (node > TOSSIM_MAX_NODES) {
-    node = TOSSIM_MAX_NODES;
+  if (node > gainNodes) {
+    node = gainNodes;
   }
   return localNoise[node].range;
 }
@@ -147,29 +501,15 @@ double sim_gain_noise_range(int node) {
 // [mean-range, mean+range].
 double sim_gain_sample_noise(int node)  __attribute__ ((C, spontaneous)) {
   double val, adjust;
-  if (node > TOSSIM_MAX_NODES) {
-    node = TOSSIM_MAX_NODES;
+  if (node > gainNodes) {
+    node = gainNodes;
   } 
   val = localNoise[node].mean;
-  adjust = (sim_random() % 2000000);
-  adjust /= 1000000.0;
-  adjust -= 1.0;
+  adjust = sim_random_uniform(node, SIM_RANDOM_GAIN) * 2.0 - 1.0;
   adjust *= localNoise[node].range;
   return val + adjust;
 }
 
-gain_entry_t* sim_gain_allocate_link(int mote) {
-  gain_entry_t* newLink = (gain_entry_t*)malloc(sizeof(gain_entry_t));
-  newLink->next = NULL;
-  newLink->mote = mote;
-  newLink->gain = -10000000.0;
-  return newLink;
-}
-
-void sim_gain_deallocate_link(gain_entry_t* linkToDelete) __attribute__ ((C, spontaneous)) {
-  free(linkToDelete);
-}
-
 void sim_gain_set_sensitivity(double s) __attribute__ ((C, spontaneous)) {
   sensitivity = s;
 }
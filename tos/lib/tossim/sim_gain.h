@@ -50,16 +50,38 @@
 extern "C" {
 #endif
 
+/*
+ * The links out of a node are stored in one contiguous array, most
+ * recently added first, so walking them with sim_gain_first() and
+ * sim_gain_next() visits neighbors in the same order the old linked
+ * lists did. Each entry also caches the gain of the link in the
+ * opposite direction (1.0 if there is none, as sim_gain_value()
+ * reports), so a transmission can compute both the forward and the
+ * acknowledgement power without a lookup per neighbor.
+ *
+ * Entries are only valid until the next sim_gain_add() or
+ * sim_gain_remove() on the same source, or the next
+ * sim_gain_add_links() or sim_gain_load_file().
+ *
+ * Compiling with -DTOSSIM_GAIN_MATRIX also keeps a dense
+ * (sim_max_nodes() + 1)^2 matrix of gains, which makes
+ * sim_gain_value() and sim_gain_connected() O(1). It costs
+ * 9 bytes per node pair, so it is only worthwhile for small
+ * networks.
+ */
 typedef struct gain_entry {
   int mote;
   double gain;
-  struct gain_entry* next;  
+  double reverseGain; // Gain from mote back to the source
 } gain_entry_t;
   
+void sim_gain_init(int nodes);
 void sim_gain_add(int src, int dest, double gain);
 double sim_gain_value(int src, int dest);
 bool sim_gain_connected(int src, int dest);
 void sim_gain_remove(int src, int dest);
+void sim_gain_add_links(const double* links, int count);
+int sim_gain_load_file(const char* path);
 void sim_gain_set_noise_floor(int node, double mean, double range);
 double sim_gain_sample_noise(int node);
 double sim_gain_noise_mean(int node);
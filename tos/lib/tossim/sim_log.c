@@ -43,14 +43,18 @@
 #include <stdarg.h>
 #include <hashtable.h>
 #include <string.h>
+#include <sim_trace.h>
 
 enum {
-  DEFAULT_CHANNEL_SIZE = 8
+  DEFAULT_CHANNEL_SIZE = 8,
+  SIM_LOG_LINE_SIZE = 256,        // Longer lines are formatted on the heap
+  SIM_LOG_TRACE_BUFFER = 1 << 20, // stdio buffer for the binary trace
 };
 
 typedef struct sim_log_output {
   int num;
   FILE** files;
+  bool trace;   // Whether the debug point is recorded in the trace
 } sim_log_output_t;
 
 typedef struct sim_log_channel {
@@ -67,11 +71,40 @@ enum {
 sim_log_output_t outputs[SIM_LOG_OUTPUT_COUNT];
 struct hashtable* channelTable = NULL;
 
+// Bit i is clear once debug point i is known to have no outputs, so
+// the dbg() macros skip it without evaluating their arguments. All
+// bits are set again whenever the channels change.
+uint8_t sim_log_mask[SIM_LOG_MASK_BYTES(SIM_LOG_OUTPUT_COUNT)];
+
+// Set when text has been written since the last sim_log_flush().
+bool sim_log_dirty = FALSE;
+
+FILE* traceFile = NULL;
+struct hashtable* traceChannels = NULL;
+// Bit i is set once the trace holds the definition of debug point i.
+uint8_t traceDefined[SIM_LOG_MASK_BYTES(SIM_LOG_OUTPUT_COUNT)];
+
 
 static unsigned int sim_log_hash(void* key);
 static int sim_log_eq(void* key1, void* key2);
 
 
+// Copy the next channel name in a comma-separated list into
+// newName, returning the rest of the list or NULL if this was the
+// last one.
+static char* nextChannel(char* namePos, char* newName) {
+  char* termination = strchr(namePos, ',');
+  // If we've reached the end, just copy to the end
+  if (termination == NULL) {
+    strcpy(newName, namePos);
+    return NULL;
+  }
+  // Otherwise, memcpy over and null terminate
+  memcpy(newName, namePos, (termination - namePos));
+  newName[termination - namePos] = 0;
+  return termination + 1;
+}
+
 // First we count how many outputs there are,
 // then allocate a FILE** large enough and fill it in.
 // This FILE** might be larger than needed, because
@@ -81,36 +114,27 @@ static int sim_log_eq(void* key1, void* key2);
 // to stdout. So when the channel's FILE*s are copied
 // into the debug point output array, this checks
 // for redundancies by checking file descriptors.
+// This also decides whether the debug point is traced,
+// and clears its bit in sim_log_mask if it has no outputs.
 static void fillInOutput(int id, char* name) {
-  char* termination = name;
   char* namePos = name;
   int count = 0;
   char* newName = (char*)malloc(strlen(name) + 1);
   memset(newName, 0, strlen(name) + 1);
+  outputs[id].trace = FALSE;
   // Count the outputs
-  while (termination != NULL) {
+  while (namePos != NULL) {
     sim_log_channel_t* channel;
-    
-    termination = strrchr(namePos, ',');
-    // If we've reached the end, just copy to the end
-    if (termination == NULL) {
-      strcpy(newName, namePos);
-    }
-    // Otherwise, memcpy over and null terminate
-    else {
-      memcpy(newName, namePos, (termination - namePos));
-      newName[termination - namePos] = 0;
-    }
-    
+    namePos = nextChannel(namePos, newName);
     channel = hashtable_search(channelTable, newName);
     if (channel != NULL) {
       count += channel->numOutputs;
     }
-
-    namePos = termination + 1;
+    if (traceFile != NULL && hashtable_search(traceChannels, newName) != NULL) {
+      outputs[id].trace = TRUE;
+    }
   }
 
-  termination = name;
   namePos = name;
   
   // Allocate
@@ -118,20 +142,9 @@ static void fillInOutput(int id, char* name) {
   outputs[id].num = 0;
 
   // Fill it in
-  while (termination != NULL) {
+  while (namePos != NULL) {
     sim_log_channel_t* channel;
-    
-    termination = strrchr(namePos, ',');
-    // If we've reached the end, just copy to the end
-    if (termination == NULL) {
-      strcpy(newName, namePos);
-    }
-    // Otherwise, memcpy over and null terminate
-    else {
-      memcpy(newName, namePos, (termination - namePos));
-      newName[termination - namePos] = 0;
-    }
-    
+    namePos = nextChannel(namePos, newName);
     channel = hashtable_search(channelTable, newName);
     if (channel != NULL) {
       int i, j;
@@ -152,7 +165,11 @@ static void fillInOutput(int id, char* name) {
 	}
       }
     }
-    namePos = termination + 1;
+  }
+  free(newName);
+
+  if (outputs[id].num == 0 && !outputs[id].trace) {
+    sim_log_mask[id >> 3] &= ~(1 << (id & 7));
   }
 }
 
@@ -160,6 +177,7 @@ void sim_log_init() {
   int i;
 
   channelTable = create_hashtable(128, sim_log_hash, sim_log_eq);
+  traceChannels = create_hashtable(16, sim_log_hash, sim_log_eq);
   
   for (i = 0; i < SIM_LOG_OUTPUT_COUNT; i++) {
     outputs[i].num = 1;
@@ -240,67 +258,235 @@ void sim_log_commit_change() {
       outputs[i].files = NULL;
     }
   }
+  memset(sim_log_mask, 0xff, sizeof(sim_log_mask));
 }
 
+/* Text output is not flushed per debug statement; the simulator
+   calls this when control returns to the script. */
+void sim_log_flush() {
+  if (sim_log_dirty) {
+    fflush(NULL);
+    sim_log_dirty = FALSE;
+  }
+  if (traceFile != NULL) {
+    fflush(traceFile);
+  }
+}
 
-void sim_log_debug(uint16_t id, char* string, const char* format, ...) {
-  va_list args;
-  int i;
-  if (outputs[id].files == NULL) {
-    fillInOutput(id, string);
+bool sim_log_open_trace(char* path) {
+  sim_log_close_trace();
+  traceFile = fopen(path, "wb");
+  if (traceFile == NULL) {
+    return FALSE;
   }
-  for (i = 0; i < outputs[id].num; i++) {
-    FILE* file = outputs[id].files[i];
-    va_start(args, format);
-    fprintf(file, "DEBUG (%i): ", (int)sim_node());
-    vfprintf(file, format, args); 
-    fflush(file);
+  setvbuf(traceFile, NULL, _IOFBF, SIM_LOG_TRACE_BUFFER);
+  {
+    uint32_t version = SIM_TRACE_VERSION;
+    int64_t ticks = sim_ticks_per_sec();
+    fwrite(SIM_TRACE_MAGIC, strlen(SIM_TRACE_MAGIC), 1, traceFile);
+    fwrite(&version, sizeof(version), 1, traceFile);
+    fwrite(&ticks, sizeof(ticks), 1, traceFile);
   }
+  memset(traceDefined, 0, sizeof(traceDefined));
+  sim_log_commit_change();
+  return TRUE;
 }
 
-void sim_log_error(uint16_t id, char* string, const char* format, ...) {
-  va_list args;
-  int i;
-  if (outputs[id].files == NULL) {
-    fillInOutput(id, string);
+void sim_log_close_trace() {
+  if (traceFile != NULL) {
+    fclose(traceFile);
+    traceFile = NULL;
+    sim_log_commit_change();
   }
-  for (i = 0; i < outputs[id].num; i++) {
-    FILE* file = outputs[id].files[i];
-    va_start(args, format);
-    fprintf(file, "ERROR (%i): ", (int)sim_node());
-    vfprintf(file, format, args);
-    fflush(file);
+}
+
+void sim_log_add_trace_channel(char* name) {
+  if (hashtable_search(traceChannels, name) == NULL) {
+    char* newName = (char*)malloc(strlen(name) + 1);
+    strcpy(newName, name);
+    hashtable_insert(traceChannels, newName, newName);
+    sim_log_commit_change();
   }
 }
 
-void sim_log_debug_clear(uint16_t id, char* string, const char* format, ...) {
-  va_list args;
+bool sim_log_remove_trace_channel(char* name) {
+  // The table frees the key, which is also the value
+  if (hashtable_remove(traceChannels, name) == NULL) {
+    return FALSE;
+  }
+  sim_log_commit_change();
+  return TRUE;
+}
+
+static void sim_log_trace_string(const char* str) {
+  uint32_t len = (str == NULL)? SIM_TRACE_NULL_STRING : strlen(str);
+  fwrite(&len, sizeof(len), 1, traceFile);
+  if (str != NULL) {
+    fwrite(str, len, 1, traceFile);
+  }
+}
+
+static bool sim_log_modifier(sim_trace_conversion_t* c, const char* modifier) {
+  return c->modifierLength == (int)strlen(modifier) &&
+    strncmp(c->modifier, modifier, c->modifierLength) == 0;
+}
+
+// Record one output of a debug point: see sim_trace.h for the format.
+static void sim_log_trace(uint16_t id, uint8_t kind, char* string, const char* format, va_list args) {
+  uint8_t type;
+  uint32_t node = sim_node();
+  int64_t now = sim_time();
+  sim_trace_conversion_t c;
+
+  if (!(traceDefined[id >> 3] & (1 << (id & 7)))) {
+    type = SIM_TRACE_DEFINE;
+    fwrite(&type, sizeof(type), 1, traceFile);
+    fwrite(&id, sizeof(id), 1, traceFile);
+    fwrite(&kind, sizeof(kind), 1, traceFile);
+    sim_log_trace_string(string);
+    sim_log_trace_string(format);
+    traceDefined[id >> 3] |= (1 << (id & 7));
+  }
+
+  type = SIM_TRACE_RECORD;
+  fwrite(&type, sizeof(type), 1, traceFile);
+  fwrite(&id, sizeof(id), 1, traceFile);
+  fwrite(&node, sizeof(node), 1, traceFile);
+  fwrite(&now, sizeof(now), 1, traceFile);
+
+  while (sim_trace_next_conversion(format, &c)) {
+    int64_t value = 0;
+    int i;
+    format = c.end;
+    for (i = 0; i < c.stars; i++) {
+      value = va_arg(args, int);
+      fwrite(&value, sizeof(value), 1, traceFile);
+    }
+    switch (c.arg) {
+    case SIM_TRACE_ARG_SIGNED:
+      if (sim_log_modifier(&c, "hh")) {value = (signed char)va_arg(args, int);}
+      else if (sim_log_modifier(&c, "h")) {value = (short)va_arg(args, int);}
+      else if (sim_log_modifier(&c, "l")) {value = va_arg(args, long);}
+      else if (sim_log_modifier(&c, "ll") || sim_log_modifier(&c, "q")) {value = va_arg(args, long long);}
+      else if (sim_log_modifier(&c, "j")) {value = va_arg(args, intmax_t);}
+      else if (sim_log_modifier(&c, "z")) {value = (ssize_t)va_arg(args, size_t);}
+      else if (sim_log_modifier(&c, "t")) {value = va_arg(args, ptrdiff_t);}
+      else {value = va_arg(args, int);}
+      fwrite(&value, sizeof(value), 1, traceFile);
+      break;
+    case SIM_TRACE_ARG_UNSIGNED:
+      if (sim_log_modifier(&c, "hh")) {value = (unsigned char)va_arg(args, unsigned int);}
+      else if (sim_log_modifier(&c, "h")) {value = (unsigned short)va_arg(args, unsigned int);}
+      else if (sim_log_modifier(&c, "l")) {value = va_arg(args, unsigned long);}
+      else if (sim_log_modifier(&c, "ll") || sim_log_modifier(&c, "q")) {value = va_arg(args, unsigned long long);}
+      else if (sim_log_modifier(&c, "j")) {value = va_arg(args, uintmax_t);}
+      else if (sim_log_modifier(&c, "z")) {value = va_arg(args, size_t);}
+      else if (sim_log_modifier(&c, "t")) {value = va_arg(args, ptrdiff_t);}
+      else {value = va_arg(args, unsigned int);}
+      fwrite(&value, sizeof(value), 1, traceFile);
+      break;
+    case SIM_TRACE_ARG_DOUBLE: {
+      double d;
+      if (sim_log_modifier(&c, "L")) {d = va_arg(args, long double);}
+      else {d = va_arg(args, double);}
+      fwrite(&d, sizeof(d), 1, traceFile);
+      break;
+    }
+    case SIM_TRACE_ARG_STRING:
+      sim_log_trace_string(va_arg(args, char*));
+      break;
+    case SIM_TRACE_ARG_POINTER: {
+      uint64_t p = (uintptr_t)va_arg(args, void*);
+      fwrite(&p, sizeof(p), 1, traceFile);
+      break;
+    }
+    default:
+      if (c.conversion == 'n') {
+	va_arg(args, void*);
+      }
+      break;
+    }
+  }
+}
+
+// Format a line once and write it to every text output of the
+// debug point. prefix, if not NULL, takes the node ID.
+static void sim_log_print(uint16_t id, const char* prefix, const char* format, va_list args) {
+  char buf[SIM_LOG_LINE_SIZE];
+  char* line = buf;
+  int prefixLength = 0;
+  int length;
   int i;
-  if (outputs[id].files == NULL) {
-    fillInOutput(id, string);
+  va_list copy;
+
+  if (prefix != NULL) {
+    prefixLength = snprintf(buf, sizeof(buf), prefix, (int)sim_node());
+  }
+  va_copy(copy, args);
+  length = vsnprintf(buf + prefixLength, sizeof(buf) - prefixLength, format, copy);
+  va_end(copy);
+  if (length < 0) {
+    return;
+  }
+  length += prefixLength;
+  if (length >= (int)sizeof(buf)) {
+    line = (char*)malloc(length + 1);
+    memcpy(line, buf, prefixLength);
+    vsnprintf(line + prefixLength, length + 1 - prefixLength, format, args);
   }
   for (i = 0; i < outputs[id].num; i++) {
-    FILE* file = outputs[id].files[i];
-    va_start(args, format);
-    vfprintf(file, format, args);
-    fflush(file);
+    fwrite(line, length, 1, outputs[id].files[i]);
+  }
+  if (line != buf) {
+    free(line);
   }
+  sim_log_dirty = TRUE;
 }
 
-void sim_log_error_clear(uint16_t id, char* string, const char* format, ...) {
-  va_list args;
-  int i;
+static void sim_log_output(uint16_t id, uint8_t kind, char* string, const char* prefix, const char* format, va_list args) {
   if (outputs[id].files == NULL) {
     fillInOutput(id, string);
   }
-  for (i = 0; i < outputs[id].num; i++) {
-    FILE* file = outputs[id].files[i];
-    va_start(args, format);
-    vfprintf(file, format, args);
-    fflush(file);
+  if (outputs[id].trace) {
+    va_list copy;
+    va_copy(copy, args);
+    sim_log_trace(id, kind, string, format, copy);
+    va_end(copy);
+  }
+  if (outputs[id].num > 0) {
+    sim_log_print(id, prefix, format, args);
   }
 }
 
+
+void sim_log_debug(uint16_t id, char* string, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  sim_log_output(id, SIM_TRACE_DEBUG, string, "DEBUG (%i): ", format, args);
+  va_end(args);
+}
+
+void sim_log_error(uint16_t id, char* string, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  sim_log_output(id, SIM_TRACE_ERROR, string, "ERROR (%i): ", format, args);
+  va_end(args);
+}
+
+void sim_log_debug_clear(uint16_t id, char* string, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  sim_log_output(id, SIM_TRACE_DEBUG_CLEAR, string, NULL, format, args);
+  va_end(args);
+}
+
+void sim_log_error_clear(uint16_t id, char* string, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  sim_log_output(id, SIM_TRACE_ERROR_CLEAR, string, NULL, format, args);
+  va_end(args);
+}
+
 /* This is the sdbm algorithm, taken from
    http://www.cs.yorku.ca/~oz/hash.html -pal */
 static unsigned int sim_log_hash(void* key) {
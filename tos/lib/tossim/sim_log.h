@@ -36,6 +36,12 @@
  * of outputs, and a debug statement can be associated with any
  * number of channels.
  *
+ * Channels can also be recorded in a binary trace (see sim_trace.h),
+ * which stores the raw arguments of each debug statement rather than
+ * formatting them; trace/print-trace formats a trace offline.
+ * Text output is buffered and flushed by sim_log_flush(), which the
+ * simulator calls when control returns to the script.
+ *
  * @author Philip Levis
  * @date   Nov 22 2005
  */
@@ -46,11 +52,28 @@
 #ifndef SIM_LOG_H_INCLUDED
 #define SIM_LOG_H_INCLUDED
 
+/*
+ * Each debug statement has a bit in sim_log_mask, which is cleared
+ * once the statement is known to have no outputs (none of its
+ * channels is connected to a file or to the binary trace). The
+ * macros test it first, so a disabled statement costs a load and a
+ * branch and its arguments are never evaluated.
+ */
+#define SIM_LOG_MASK_BYTES(count) (((count) / 8) + 1)
+#define sim_log_enabled(id) (sim_log_mask[(id) >> 3] & (1 << ((id) & 7)))
+
+#define sim_log_call(fn, s, ...) do {				\
+    uint16_t sim_log_id = unique("TOSSIM.debug");		\
+    if (sim_log_enabled(sim_log_id)) {				\
+      fn(sim_log_id, s, __VA_ARGS__);				\
+    }								\
+  } while (0)
+
 #ifndef TOSSIM_NO_DEBUG
-#define dbg(s, ...) sim_log_debug(unique("TOSSIM.debug"), s, __VA_ARGS__)
-#define dbg_clear(s, ...) sim_log_debug_clear(unique("TOSSIM.debug"), s, __VA_ARGS__)
-#define dbgerror(s, ...) sim_log_error(unique("TOSSIM.debug"), s, __VA_ARGS__)
-#define dbgerror_clear(s, ...) sim_log_error_clear(unique("TOSSIM.debug"), s, __VA_ARGS__)
+#define dbg(s, ...) sim_log_call(sim_log_debug, s, __VA_ARGS__)
+#define dbg_clear(s, ...) sim_log_call(sim_log_debug_clear, s, __VA_ARGS__)
+#define dbgerror(s, ...) sim_log_call(sim_log_error, s, __VA_ARGS__)
+#define dbgerror_clear(s, ...) sim_log_call(sim_log_error_clear, s, __VA_ARGS__)
 #else
 #define dbg(s, ...)
 #define dbg_clear(s, ...)
@@ -62,10 +85,18 @@
 extern "C" {
 #endif
 
+extern uint8_t sim_log_mask[];
+
 void sim_log_init();
 void sim_log_add_channel(char* output, FILE* file);
 bool sim_log_remove_channel(char* output, FILE* file);
 void sim_log_commit_change();
+void sim_log_flush();
+
+bool sim_log_open_trace(char* path);
+void sim_log_close_trace();
+void sim_log_add_trace_channel(char* output);
+bool sim_log_remove_trace_channel(char* output);
 
 void sim_log_debug(uint16_t id, char* string, const char* format, ...);
 void sim_log_error(uint16_t id, char* string, const char* format, ...);
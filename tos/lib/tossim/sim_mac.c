@@ -40,6 +40,8 @@
 
 #include <sim_csma.c>
 #include <sim_gain.c>
+#include <sim_dbm.c>
+#include <sim_prr.c>
 
 //Added by HyungJune Lee
 #include <randomlib.c>
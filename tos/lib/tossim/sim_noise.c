@@ -43,8 +43,12 @@
 #include <math.h>
 #include <sys/time.h>
 #include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include "randomlib.h"
-#include "hashtable.h"
 #include "sim_noise.h"
 
 //Tal Debug, to count how often simulation hits the one match case
@@ -53,60 +57,191 @@ int numCase2 = 0;
 int numTotal = 0;
 //End Tal Debug
 
-uint32_t FreqKeyNum = 0;
-
-sim_noise_node_t noiseData[TOSSIM_MAX_NODES];
+enum {
+  NOISE_FILE_VERSION = 2,
+};
+
+// On-disk layout: this header, then the keys, the entries and the
+// index table, each starting on an 8-byte boundary.
+typedef struct sim_noise_file_header {
+  char magic[8];
+  uint32_t version;
+  uint32_t history;
+  uint32_t numValues;
+  uint32_t entrySize;
+  uint32_t numEntries;
+  uint32_t tableSize;
+  int32_t freqEntry;
+  uint32_t traceHash;
+  char prefix[NOISE_HISTORY];
+  char initialKey[NOISE_HISTORY];
+} sim_noise_file_header_t;
+
+static const char noiseFileMagic[8] = {'T', 'O', 'S', 'N', 'O', 'I', 'S', 'E'};
+
+// One entry per node, plus a last one shared by every node at or
+// past noiseNodes (the 0xffff catch-all mote, for example).
+sim_noise_node_t* noiseData = NULL;
+int noiseNodes = 0;
+sim_noise_model_t* noiseModels = NULL;
 
 static unsigned int sim_noise_hash(void *key);
 static int sim_noise_eq(void *key1, void *key2);
 
-void makeNoiseModel(uint16_t node_id);
-void makePmfDistr(uint16_t node_id);
 uint8_t search_bin_num(char noise);
 
+static inline sim_noise_node_t* sim_noise_node(uint16_t node_id) {
+  if (node_id > noiseNodes) {
+    node_id = noiseNodes;
+  }
+  return &noiseData[node_id];
+}
+
+static size_t sim_noise_align(size_t len) {
+  return (len + 7) & ~((size_t)7);
+}
+
+// Write len bytes and pad them out to an 8-byte boundary.
+static bool sim_noise_write(FILE* file, const void* data, size_t len) {
+  static const char pad[8] = {0};
+  size_t padLen = sim_noise_align(len) - len;
+  return fwrite(data, 1, len, file) == len &&
+    fwrite(pad, 1, padLen, file) == padLen;
+}
+
+static void sim_noise_release(sim_noise_model_t* model) {
+  sim_noise_model_t** prev;
+  if (model == NULL || --model->refs > 0) {
+    return;
+  }
+  for (prev = &noiseModels; *prev != NULL; prev = &(*prev)->next) {
+    if (*prev == model) {
+      *prev = model->next;
+      break;
+    }
+  }
+  if (model->mapping != NULL) {
+    munmap(model->mapping, model->mappingLen);
+  }
+  else {
+    free(model->keys);
+    free(model->entries);
+    free(model->table);
+  }
+  free(model->trace);
+  free(model);
+}
+
+static void sim_noise_use(uint16_t node_id, sim_noise_model_t* model) {
+  sim_noise_node_t* node = sim_noise_node(node_id);
+  model->refs++;
+  sim_noise_release(node->model);
+  node->model = model;
+  memcpy(node->key, model->initialKey, NOISE_HISTORY);
+  node->keyHash = sim_noise_hash(node->key);
+  node->noiseGenTime = 0;
+  node->lastNoiseVal = 0;
+  node->generated = 1;
+}
+
 void sim_noise_init()__attribute__ ((C, spontaneous))
 {
   int j;
   
-  //printf("Starting\n");
-  
-  for (j=0; j< TOSSIM_MAX_NODES; j++) {
-    noiseData[j].noiseTable = create_hashtable(NOISE_HASHTABLE_SIZE, sim_noise_hash, sim_noise_eq);
-    noiseData[j].noiseGenTime = 0;
-    noiseData[j].noiseTrace = (char*)(malloc(sizeof(char) * NOISE_MIN_TRACE));
-    noiseData[j].noiseTraceLen = NOISE_MIN_TRACE;
-    noiseData[j].noiseTraceIndex = 0;
-
+  for (j=0; j<= noiseNodes && noiseData != NULL; j++) {
+    sim_noise_release(noiseData[j].model);
+    free(noiseData[j].noiseTrace);
   }
-  //printf("Done with sim_noise_init()\n");
-}
-
-void sim_noise_create_model(uint16_t node_id)__attribute__ ((C, spontaneous)) {
-  makeNoiseModel(node_id);
-  makePmfDistr(node_id);
+  free(noiseData);
+  noiseNodes = sim_max_nodes();
+  noiseData = (sim_noise_node_t*)calloc(noiseNodes + 1, sizeof(sim_noise_node_t));
 }
 
 char sim_real_noise(uint16_t node_id, uint32_t cur_t) {
-  if (cur_t > noiseData[node_id].noiseTraceLen) {
-    dbg("Noise", "Asked for noise element %u when there are only %u.\n", cur_t, noiseData[node_id].noiseTraceIndex);
+  sim_noise_model_t* model = sim_noise_node(node_id)->model;
+  if (model == NULL || cur_t >= model->traceLen) {
+    dbg("Noise", "Asked for noise element %u when there are only %u.\n", cur_t, (model == NULL)? 0 : model->traceLen);
     return 0;
   }
-  return noiseData[node_id].noiseTrace[cur_t];
+  return model->trace[cur_t];
 }
 
 void sim_noise_trace_add(uint16_t node_id, char noiseVal)__attribute__ ((C, spontaneous)) {
-  // Need to double size of trace arra
-  if (noiseData[node_id].noiseTraceIndex ==
-      noiseData[node_id].noiseTraceLen) {
-    char* data = (char*)(malloc(sizeof(char) * noiseData[node_id].noiseTraceLen * 2));
-    memcpy(data, noiseData[node_id].noiseTrace, noiseData[node_id].noiseTraceLen);
-    free(noiseData[node_id].noiseTrace);
-    noiseData[node_id].noiseTraceLen *= 2;
-    noiseData[node_id].noiseTrace = data;
-  }
-  noiseData[node_id].noiseTrace[noiseData[node_id].noiseTraceIndex] = noiseVal;
-  noiseData[node_id].noiseTraceIndex++;
-  dbg("Insert", "Adding noise value %i for %i of %i\n", (int)noiseData[node_id].noiseTraceIndex, (int)node_id, (int)noiseVal);
+  sim_noise_node_t* node = sim_noise_node(node_id);
+  // Need to double size of trace array
+  if (node->noiseTraceIndex == node->noiseTraceLen) {
+    uint32_t newLen = (node->noiseTraceLen == 0)? NOISE_MIN_TRACE : node->noiseTraceLen * 2;
+    node->noiseTrace = (char*)realloc(node->noiseTrace, sizeof(char) * newLen);
+    node->noiseTraceLen = newLen;
+  }
+  node->noiseTrace[node->noiseTraceIndex] = noiseVal;
+  node->noiseTraceIndex++;
+  dbg("Insert", "Adding noise value %i for %i of %i\n", (int)node->noiseTraceIndex, (int)node_id, (int)noiseVal);
+}
+
+void sim_noise_trace_add_readings(uint16_t node_id, const char* values, uint32_t count)__attribute__ ((C, spontaneous)) {
+  sim_noise_node_t* node = sim_noise_node(node_id);
+  if (node->noiseTraceIndex + count > node->noiseTraceLen) {
+    uint32_t newLen = (node->noiseTraceLen == 0)? NOISE_MIN_TRACE : node->noiseTraceLen;
+    while (newLen < node->noiseTraceIndex + count) {
+      newLen *= 2;
+    }
+    node->noiseTrace = (char*)realloc(node->noiseTrace, sizeof(char) * newLen);
+    node->noiseTraceLen = newLen;
+  }
+  memcpy(node->noiseTrace + node->noiseTraceIndex, values, count);
+  node->noiseTraceIndex += count;
+  dbg("Insert", "Adding %u noise values for %i\n", count, (int)node_id);
+}
+
+// The last trace file parsed by sim_noise_trace_load(). Scripts
+// usually give every node the same trace, so it is parsed once.
+static char* noiseFileValues = NULL;
+static uint32_t noiseFileCount = 0;
+static char* noiseFilePath = NULL;
+static struct stat noiseFileStat;
+
+// Append the readings in a noise trace file (one dBm value per
+// line, blank lines ignored) to a node's trace. Returns the number
+// of readings, or -1 if the file cannot be read.
+int sim_noise_trace_load(uint16_t node_id, const char* path)__attribute__ ((C, spontaneous)) {
+  struct stat st;
+  if (stat(path, &st) != 0) {
+    dbgerror("TOSSIM", "Could not open noise trace file %s.\n", path);
+    return -1;
+  }
+  if (noiseFilePath == NULL || strcmp(noiseFilePath, path) != 0 ||
+      st.st_dev != noiseFileStat.st_dev || st.st_ino != noiseFileStat.st_ino ||
+      st.st_size != noiseFileStat.st_size || st.st_mtime != noiseFileStat.st_mtime) {
+    FILE* file = fopen(path, "r");
+    char line[64];
+    uint32_t size = NOISE_MIN_TRACE;
+    if (file == NULL) {
+      dbgerror("TOSSIM", "Could not open noise trace file %s.\n", path);
+      return -1;
+    }
+    free(noiseFilePath);
+    free(noiseFileValues);
+    noiseFilePath = strdup(path);
+    noiseFileValues = (char*)malloc(size);
+    noiseFileCount = 0;
+    noiseFileStat = st;
+    while (fgets(line, sizeof(line), file) != NULL) {
+      char* end;
+      long val = strtol(line, &end, 10);
+      if (end == line) {
+	continue;
+      }
+      if (noiseFileCount == size) {
+	size *= 2;
+	noiseFileValues = (char*)realloc(noiseFileValues, size);
+      }
+      noiseFileValues[noiseFileCount++] = (char)val;
+    }
+    fclose(file);
+  }
+  sim_noise_trace_add_readings(node_id, noiseFileValues, noiseFileCount);
+  return (int)noiseFileCount;
 }
 
 
@@ -127,6 +262,9 @@ char search_noise_from_bin_num(int i)__attribute__ ((C, spontaneous))
   return noise;
 }
 
+// sdbm over the history: hashVal = hashVal * 65599 + c for each
+// bin. Because it is a polynomial hash, a node can update it in O(1)
+// as its history shifts (see sim_noise_shift_key()).
 static unsigned int sim_noise_hash(void *key) {
   char *pt = (char *)key;
   unsigned int hashVal = 0;
@@ -141,173 +279,489 @@ static int sim_noise_eq(void *key1, void *key2) {
   return (memcmp((void *)key1, (void *)key2, NOISE_HISTORY) == 0);
 }
 
-void sim_noise_add(uint16_t node_id, char noise)__attribute__ ((C, spontaneous))
-{
-  int i;
-  struct hashtable *pnoiseTable = noiseData[node_id].noiseTable;
-  char *key = noiseData[node_id].key;
-  sim_noise_hash_t *noise_hash;
-  noise_hash = (sim_noise_hash_t *)hashtable_search(pnoiseTable, key);
-  dbg("Insert", "Adding noise value %hhi\n", noise);
-  if (noise_hash == NULL)	{
-    noise_hash = (sim_noise_hash_t *)malloc(sizeof(sim_noise_hash_t));
-    memcpy((void *)(noise_hash->key), (void *)key, NOISE_HISTORY);
-    
-    noise_hash->numElements = 0;
-    noise_hash->size = NOISE_DEFAULT_ELEMENT_SIZE;
-    noise_hash->elements = (char *)malloc(sizeof(char)*noise_hash->size);
-    memset((void *)noise_hash->elements, 0, sizeof(char)*noise_hash->size);
-
-    noise_hash->flag = 0;
-    for(i=0; i<NOISE_NUM_VALUES; i++) {
-	noise_hash->dist[i] = 0;
-    }
-    hashtable_insert(pnoiseTable, key, noise_hash);
-    dbg("Insert", "Inserting %p into table %p with key ", noise_hash, pnoiseTable);
-    {
-      int ctr;
-      for(ctr = 0; ctr < NOISE_HISTORY; ctr++)
-	dbg_clear("Insert", "%0.3hhi ", key[ctr]);
-    }
-    dbg_clear("Insert", "\n");
+// FNV-1a over the raw trace, to find nodes that read the same trace.
+static uint32_t sim_noise_trace_hash(char* trace, uint32_t len) {
+  uint32_t hashVal = 2166136261U;
+  uint32_t i;
+  for (i = 0; i < len; i++) {
+    hashVal ^= (uint8_t)trace[i];
+    hashVal *= 16777619U;
   }
+  return hashVal;
+}
 
-  if (noise_hash->numElements == noise_hash->size)
-    {
-      char *newElements;
-      int newSize = (noise_hash->size)*2;
+// Returns the slot for key: either the one holding its entry or the
+// empty one where it belongs. The low bits of the sdbm hash of a
+// short history are poorly distributed, so mix them first.
+static int sim_noise_slot(int* table, int tableSize, char* keys, char* key, unsigned int hashVal) {
+  int mask = tableSize - 1;
+  int slot;
+  hashVal ^= hashVal >> 15;
+  hashVal *= 0x2c1b3c6dU;
+  hashVal ^= hashVal >> 12;
+  slot = hashVal & mask;
+  while (table[slot] >= 0 &&
+	 !sim_noise_eq(keys + table[slot] * NOISE_HISTORY, key)) {
+    slot = (slot + 1) & mask;
+  }
+  return slot;
+}
 
-      newElements = (char *)malloc(sizeof(char)*newSize);
-      memcpy(newElements, noise_hash->elements, noise_hash->size);
-      free(noise_hash->elements);
-      noise_hash->elements = newElements;
-      noise_hash->size = newSize;
-    }
+static int sim_noise_lookup(sim_noise_model_t* model, char* key, unsigned int hashVal) {
+  return model->table[sim_noise_slot(model->table, model->tableSize, model->keys, key, hashVal)];
+}
 
-  noise_hash->elements[noise_hash->numElements] = noise;
-//  printf("I hear noise %i\n", noise);
-  noise_hash->numElements++;
+// 65599^(NOISE_HISTORY - 1), the weight of the oldest bin in the hash
+static unsigned int sim_noise_oldest_weight() {
+  static unsigned int weight = 0;
+  if (weight == 0) {
+    int i;
+    weight = 1;
+    for (i = 0; i < NOISE_HISTORY - 1; i++) {
+      weight *= 65599U;
+    }
+  }
+  return weight;
 }
 
-void sim_noise_dist(uint16_t node_id)__attribute__ ((C, spontaneous))
-{
-  int i;
-  uint8_t bin;
-  float cmf = 0;
-  struct hashtable *pnoiseTable = noiseData[node_id].noiseTable;
-  char *key = noiseData[node_id].key;
-  char *freqKey = noiseData[node_id].freqKey;
-  sim_noise_hash_t *noise_hash;
-  noise_hash = (sim_noise_hash_t *)hashtable_search(pnoiseTable, key);
+// Drop the oldest bin from a history and append a new one, updating
+// its hash to match.
+static void sim_noise_shift_key(char* key, unsigned int* hashVal, char bin) {
+  *hashVal = (*hashVal - (unsigned int)key[0] * sim_noise_oldest_weight()) * 65599U + bin;
+  memmove(key, key + 1, NOISE_HISTORY - 1);
+  key[NOISE_HISTORY - 1] = bin;
+}
 
-//  noise_hash->flag;
+/*
+ * Fill in an entry's alias table (Walker's method, as built by
+ * Vose) from the counts of the readings that followed its history.
+ * Each column keeps its own bin with probability prob / 65536 and
+ * otherwise yields its alias, so a sample costs one lookup whatever
+ * the number of bins.
+ */
+static void sim_noise_build_alias(sim_noise_entry_t* entry, uint32_t* counts) {
+  double scaled[NOISE_NUM_VALUES];
+  int small[NOISE_NUM_VALUES];
+  int large[NOISE_NUM_VALUES];
+  int numSmall = 0;
+  int numLarge = 0;
+  int k;
+
+  for (k = 0; k < NOISE_NUM_VALUES; k++) {
+    scaled[k] = (double)counts[k] * NOISE_NUM_VALUES / entry->numElements;
+    if (scaled[k] < 1.0) {
+      small[numSmall++] = k;
+    }
+    else {
+      large[numLarge++] = k;
+    }
+  }
+  while (numSmall > 0 && numLarge > 0) {
+    int less = small[--numSmall];
+    int more = large[--numLarge];
+    entry->prob[less] = (uint16_t)(scaled[less] * 65536.0);
+    entry->alias[less] = more;
+    scaled[more] -= 1.0 - scaled[less];
+    if (scaled[more] < 1.0) {
+      small[numSmall++] = more;
+    }
+    else {
+      large[numLarge++] = more;
+    }
+  }
+  // Whatever is left is full, up to rounding error.
+  while (numLarge > 0) {
+    k = large[--numLarge];
+    entry->prob[k] = 65535;
+    entry->alias[k] = k;
+  }
+  while (numSmall > 0) {
+    k = small[--numSmall];
+    entry->prob[k] = 65535;
+    entry->alias[k] = k;
+  }
+}
 
-  if (noise_hash->flag == 1)
-    return;
+/*
+ * Build a model from a trace: count the readings that follow each
+ * history, then turn the counts into alias tables. Takes ownership
+ * of the trace.
+ */
+static sim_noise_model_t* sim_noise_compile(char* trace, uint32_t len, uint32_t traceHash) {
+  sim_noise_model_t* model = (sim_noise_model_t*)malloc(sizeof(sim_noise_model_t));
+  int capacity = NOISE_HASHTABLE_SIZE;
+  uint32_t* counts = (uint32_t*)malloc(sizeof(uint32_t) * NOISE_NUM_VALUES * capacity);
+  char key[NOISE_HISTORY];
+  unsigned int keyHash;
+  uint32_t i;
+  int j;
 
-  for (i=0; i < NOISE_NUM_VALUES; i++) {
-    noise_hash->dist[i] = 0.0;
+  memset(model, 0, sizeof(sim_noise_model_t));
+  model->trace = trace;
+  model->traceLen = len;
+  model->traceHash = traceHash;
+  model->tableSize = NOISE_HASHTABLE_SIZE * 2;
+  model->table = (int*)malloc(sizeof(int) * model->tableSize);
+  memset(model->table, 0xff, sizeof(int) * model->tableSize);
+  model->keys = (char*)malloc(NOISE_HISTORY * capacity);
+  model->entries = (sim_noise_entry_t*)malloc(sizeof(sim_noise_entry_t) * capacity);
+
+  memset(key, 0, NOISE_HISTORY);
+  for (i = 0; i < NOISE_HISTORY && i < len; i++) {
+    key[i] = search_bin_num(trace[i]);
   }
+  keyHash = sim_noise_hash(key);
   
-  for (i=0; i< noise_hash->numElements; i++)
-    {
-      float val;
-      dbg("Noise_output", "Noise is found to be %i\n", noise_hash->elements[i]);
-      bin = noise_hash->elements[i] - NOISE_MIN_QUANTIZE; //search_bin_num(noise_hash->elements[i]) - 1;
-//      printf("Bin %i, Noise %i\n", bin, (NOISE_MIN_QUANTIZE + bin));
-      val = noise_hash->dist[bin];
-      val += (float)1.0;
-      noise_hash->dist[bin] = val;
+  for (i = NOISE_HISTORY; i < len; i++) {
+    int slot = sim_noise_slot(model->table, model->tableSize, model->keys, key, keyHash);
+    int index = model->table[slot];
+    int bin = trace[i] - NOISE_MIN_QUANTIZE;
+    
+    if (index < 0) {
+      if (model->numEntries == capacity) {
+	capacity *= 2;
+	model->keys = (char*)realloc(model->keys, NOISE_HISTORY * capacity);
+	model->entries = (sim_noise_entry_t*)realloc(model->entries, sizeof(sim_noise_entry_t) * capacity);
+	counts = (uint32_t*)realloc(counts, sizeof(uint32_t) * NOISE_NUM_VALUES * capacity);
+      }
+      index = model->numEntries++;
+      memcpy(model->keys + index * NOISE_HISTORY, key, NOISE_HISTORY);
+      memset(&model->entries[index], 0, sizeof(sim_noise_entry_t));
+      memset(&counts[index * NOISE_NUM_VALUES], 0, sizeof(uint32_t) * NOISE_NUM_VALUES);
+      model->entries[index].single = trace[i];
+      model->table[slot] = index;
+
+      // Keep the table at most half full
+      if (model->numEntries * 2 > model->tableSize) {
+	int e;
+	free(model->table);
+	model->tableSize *= 2;
+	model->table = (int*)malloc(sizeof(int) * model->tableSize);
+	memset(model->table, 0xff, sizeof(int) * model->tableSize);
+	for (e = 0; e < model->numEntries; e++) {
+	  char* k = model->keys + e * NOISE_HISTORY;
+	  model->table[sim_noise_slot(model->table, model->tableSize, model->keys, k, sim_noise_hash(k))] = e;
+	}
+      }
     }
-
-  for (i=0; i < NOISE_NUM_VALUES ; i++)
-    {
-      noise_hash->dist[i] = (noise_hash->dist[i])/(noise_hash->numElements);
-      cmf += noise_hash->dist[i];
-      noise_hash->dist[i] = cmf;
+    model->entries[index].numElements++;
+    if (bin < 0 || bin >= NOISE_NUM_VALUES) {
+      bin = 0;
     }
-  noise_hash->flag = 1;
-
-  //Find the most frequent key and store it in noiseData[node_id].freqKey[].
-  if (noise_hash->numElements > FreqKeyNum)
-    {
-      int j;
-      FreqKeyNum = noise_hash->numElements;
-      memcpy((void *)freqKey, (void *)key, NOISE_HISTORY);
-      dbg("HashZeroDebug", "Setting most frequent key (%i): ", (int) FreqKeyNum);
-      for (j = 0; j < NOISE_HISTORY; j++) {
-	dbg_clear("HashZeroDebug", "[%hhu] ", key[j]);
-      }
-      dbg_clear("HashZeroDebug", "\n");
+    counts[index * NOISE_NUM_VALUES + bin]++;
+
+    sim_noise_shift_key(key, &keyHash, search_bin_num(trace[i]));
+  }
+  memcpy(model->initialKey, key, NOISE_HISTORY);
+
+  for (j = 0; j < model->numEntries; j++) {
+    sim_noise_entry_t* entry = &model->entries[j];
+    sim_noise_build_alias(entry, &counts[j * NOISE_NUM_VALUES]);
+    // Ties go to the history seen first in the trace
+    if (entry->numElements > model->entries[model->freqEntry].numElements) {
+      model->freqEntry = j;
     }
+  }
+  free(counts);
+  dbg("Insert", "Compiled noise model with %i histories from %u readings.\n", model->numEntries, len);
+  return model;
 }
 
-void arrangeKey(uint16_t node_id)__attribute__ ((C, spontaneous))
-{
-  char *pKey = noiseData[node_id].key;
-  memcpy(pKey, pKey+1, NOISE_HISTORY-1);
+// A model needs at least one history and the reading after it, so a
+// trace no longer than NOISE_HISTORY is repeated until it is long
+// enough. The trace buffer always holds NOISE_MIN_TRACE readings.
+static void sim_noise_pad_trace(uint16_t node_id) {
+  sim_noise_node_t* node = sim_noise_node(node_id);
+  uint32_t i;
+  if (node->noiseTraceIndex == 0 || node->noiseTraceIndex > NOISE_HISTORY) {
+    return;
+  }
+  dbgerror("TOSSIM", "Noise trace of node %hu has only %u readings; repeating it.\n", node_id, node->noiseTraceIndex);
+  for (i = node->noiseTraceIndex; i < NOISE_MIN_TRACE; i++) {
+    node->noiseTrace[i] = node->noiseTrace[i % node->noiseTraceIndex];
+  }
+  node->noiseTraceIndex = NOISE_MIN_TRACE;
+}
+
+void sim_noise_create_model(uint16_t node_id)__attribute__ ((C, spontaneous)) {
+  sim_noise_node_t* node = sim_noise_node(node_id);
+  sim_noise_model_t* model;
+  uint32_t traceHash;
+
+  if (node->noiseTraceIndex == 0) {
+    dbgerror("TOSSIM", "Tried to create a noise model for node %hu with no trace.\n", node_id);
+    return;
+  }
+  sim_noise_pad_trace(node_id);
+  traceHash = sim_noise_trace_hash(node->noiseTrace, node->noiseTraceIndex);
+
+  // Share a model built from an identical trace, if there is one.
+  for (model = noiseModels; model != NULL; model = model->next) {
+    if (model->mapping == NULL &&
+	model->traceHash == traceHash &&
+	model->traceLen == node->noiseTraceIndex &&
+	memcmp(model->trace, node->noiseTrace, model->traceLen) == 0) {
+      break;
+    }
+  }
 
+  if (model == NULL) {
+    model = sim_noise_compile(node->noiseTrace, node->noiseTraceIndex, traceHash);
+    model->next = noiseModels;
+    noiseModels = model;
+  }
+  else {
+    free(node->noiseTrace);
+  }
+  node->noiseTrace = NULL;
+  node->noiseTraceLen = 0;
+  node->noiseTraceIndex = 0;
+  sim_noise_use(node_id, model);
 }
 
-/*
- * After makeNoiseModel() is done, make PMF distribution for each bin.
- */
-void makePmfDistr(uint16_t node_id)__attribute__ ((C, spontaneous))
-{
+bool sim_noise_save_model(uint16_t node_id, const char* path)__attribute__ ((C, spontaneous)) {
+  sim_noise_model_t* model = sim_noise_node(node_id)->model;
+  sim_noise_file_header_t header;
+  size_t lens[3];
+  void* parts[3];
+  FILE* file;
   int i;
-  char *pKey = noiseData[node_id].key;
-  char *fKey = noiseData[node_id].freqKey;
 
-  FreqKeyNum = 0;
-  for(i=0; i<NOISE_HISTORY; i++) {
-    pKey[i] = /* noiseData[node_id].noiseTrace[i]; // */ search_bin_num(noiseData[node_id].noiseTrace[i]);
+  if (model == NULL) {
+    return FALSE;
+  }
+  file = fopen(path, "wb");
+  if (file == NULL) {
+    return FALSE;
   }
 
-  for(i = NOISE_HISTORY; i < noiseData[node_id].noiseTraceIndex; i++) {
-    if (i == NOISE_HISTORY) {
-      //printf("Inserting first element.\n");
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, noiseFileMagic, sizeof(header.magic));
+  header.version = NOISE_FILE_VERSION;
+  header.history = NOISE_HISTORY;
+  header.numValues = NOISE_NUM_VALUES;
+  header.entrySize = sizeof(sim_noise_entry_t);
+  header.numEntries = model->numEntries;
+  header.tableSize = model->tableSize;
+  header.freqEntry = model->freqEntry;
+  header.traceHash = model->traceHash;
+  memcpy(header.prefix, model->trace, (model->traceLen < NOISE_HISTORY)? model->traceLen : NOISE_HISTORY);
+  memcpy(header.initialKey, model->initialKey, NOISE_HISTORY);
+
+  parts[0] = model->keys;
+  lens[0] = (size_t)model->numEntries * NOISE_HISTORY;
+  parts[1] = model->entries;
+  lens[1] = (size_t)model->numEntries * sizeof(sim_noise_entry_t);
+  parts[2] = model->table;
+  lens[2] = (size_t)model->tableSize * sizeof(int);
+
+  if (!sim_noise_write(file, &header, sizeof(header))) {
+    fclose(file);
+    return FALSE;
+  }
+  for (i = 0; i < 3; i++) {
+    if (!sim_noise_write(file, parts[i], lens[i])) {
+      fclose(file);
+      return FALSE;
     }
-    sim_noise_dist(node_id);
-    arrangeKey(node_id);
-    pKey[NOISE_HISTORY-1] =  search_bin_num(noiseData[node_id].noiseTrace[i]);
   }
+  return fclose(file) == 0;
+}
 
-  dbg_clear("HASH", "FreqKey = ");
-  for (i=0; i< NOISE_HISTORY ; i++)
-    {
-      dbg_clear("HASH", "%d,", fKey[i]);
+// Checks that a mapped model file is one this build wrote: the
+// header matches, the file is exactly as long as the header implies,
+// and every index in it is in range, so that a truncated or corrupt
+// file cannot send lookups or sampling outside the mapping.
+static bool sim_noise_check_file(void* mapping, size_t len) {
+  sim_noise_file_header_t* header = (sim_noise_file_header_t*)mapping;
+  size_t needed, offset;
+  sim_noise_entry_t* entries;
+  int* table;
+  uint32_t i, used;
+  int k;
+
+  if (len < sizeof(sim_noise_file_header_t) ||
+      memcmp(header->magic, noiseFileMagic, sizeof(header->magic)) != 0 ||
+      header->version != NOISE_FILE_VERSION ||
+      header->history != NOISE_HISTORY ||
+      header->numValues != NOISE_NUM_VALUES ||
+      header->entrySize != sizeof(sim_noise_entry_t) ||
+      header->numEntries == 0 ||
+      header->numEntries > len / sizeof(sim_noise_entry_t) ||
+      header->freqEntry < 0 || header->freqEntry >= (int32_t)header->numEntries ||
+      // A power of two at least twice numEntries, as compiled, so a
+      // probe always reaches an empty slot.
+      header->tableSize > len / sizeof(int) ||
+      (header->tableSize & (header->tableSize - 1)) != 0 ||
+      header->tableSize < 2 * header->numEntries) {
+    return FALSE;
+  }
+  offset = sim_noise_align(sizeof(sim_noise_file_header_t)) +
+    sim_noise_align((size_t)header->numEntries * NOISE_HISTORY);
+  needed = offset +
+    sim_noise_align((size_t)header->numEntries * sizeof(sim_noise_entry_t)) +
+    sim_noise_align((size_t)header->tableSize * sizeof(int));
+  if (len != needed) {
+    return FALSE;
+  }
+
+  entries = (sim_noise_entry_t*)((char*)mapping + offset);
+  for (i = 0; i < header->numEntries; i++) {
+    for (k = 0; k < NOISE_NUM_VALUES; k++) {
+      if (entries[i].alias[k] >= NOISE_NUM_VALUES) {
+	return FALSE;
+      }
     }
-  dbg_clear("HASH", "\n");
+  }
+  offset += sim_noise_align((size_t)header->numEntries * sizeof(sim_noise_entry_t));
+  table = (int*)((char*)mapping + offset);
+  used = 0;
+  for (i = 0; i < header->tableSize; i++) {
+    if (table[i] >= (int)header->numEntries || table[i] < -1) {
+      return FALSE;
+    }
+    if (table[i] >= 0) {
+      used++;
+    }
+  }
+  return used <= header->numEntries;
 }
 
-int dummy;
-void sim_noise_alarm() {
-  dummy = 5;
+// Maps a model file, or finds one already mapped. If a trace hash is
+// given, the file must have been compiled from that trace. Returns
+// NULL if the file cannot be used.
+static sim_noise_model_t* sim_noise_map_model(const char* path, bool checkHash, uint32_t traceHash) {
+  sim_noise_model_t* model;
+  sim_noise_file_header_t* header;
+  struct stat st;
+  size_t offset;
+  void* mapping;
+  int fd;
+
+  fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    dbgerror("TOSSIM", "Could not open noise model file %s.\n", path);
+    return NULL;
+  }
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    return NULL;
+  }
+
+  // Nodes loading the same file share one mapping.
+  for (model = noiseModels; model != NULL; model = model->next) {
+    if (model->mapping != NULL &&
+	model->fileDev == (unsigned long)st.st_dev &&
+	model->fileIno == (unsigned long)st.st_ino &&
+	model->mappingLen == (size_t)st.st_size) {
+      close(fd);
+      if (checkHash && model->traceHash != traceHash) {
+	dbgerror("TOSSIM", "Noise model file %s was not compiled from this trace.\n", path);
+	return NULL;
+      }
+      return model;
+    }
+  }
+
+  if (st.st_size < (off_t)sizeof(sim_noise_file_header_t)) {
+    dbgerror("TOSSIM", "Noise model file %s is truncated.\n", path);
+    close(fd);
+    return NULL;
+  }
+  mapping = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return NULL;
+  }
+  if (!sim_noise_check_file(mapping, st.st_size)) {
+    dbgerror("TOSSIM", "%s is not a valid noise model file for this version of TOSSIM.\n", path);
+    munmap(mapping, st.st_size);
+    return NULL;
+  }
+  header = (sim_noise_file_header_t*)mapping;
+  if (checkHash && header->traceHash != traceHash) {
+    dbgerror("TOSSIM", "Noise model file %s was not compiled from this trace.\n", path);
+    munmap(mapping, st.st_size);
+    return NULL;
+  }
+
+  model = (sim_noise_model_t*)malloc(sizeof(sim_noise_model_t));
+  memset(model, 0, sizeof(sim_noise_model_t));
+  model->mapping = mapping;
+  model->mappingLen = st.st_size;
+  model->fileDev = (unsigned long)st.st_dev;
+  model->fileIno = (unsigned long)st.st_ino;
+  model->numEntries = header->numEntries;
+  model->tableSize = header->tableSize;
+  model->freqEntry = header->freqEntry;
+  model->traceHash = header->traceHash;
+  model->traceLen = NOISE_HISTORY;
+  model->trace = (char*)malloc(NOISE_HISTORY);
+  memcpy(model->trace, header->prefix, NOISE_HISTORY);
+  memcpy(model->initialKey, header->initialKey, NOISE_HISTORY);
+
+  offset = sim_noise_align(sizeof(sim_noise_file_header_t));
+  model->keys = (char*)mapping + offset;
+  offset += sim_noise_align((size_t)model->numEntries * NOISE_HISTORY);
+  model->entries = (sim_noise_entry_t*)((char*)mapping + offset);
+  offset += sim_noise_align((size_t)model->numEntries * sizeof(sim_noise_entry_t));
+  model->table = (int*)((char*)mapping + offset);
+
+  model->next = noiseModels;
+  noiseModels = model;
+  return model;
+}
+
+// Loads a model saved by sim_noise_save_model(). If the node has a
+// trace, the file must have been compiled from it. Returns FALSE if
+// the file is missing, stale or damaged; a node with a trace then
+// compiles its model from that instead, and the caller can save the
+// file again.
+bool sim_noise_load_model(uint16_t node_id, const char* path)__attribute__ ((C, spontaneous)) {
+  sim_noise_node_t* node = sim_noise_node(node_id);
+  bool haveTrace = node->noiseTraceIndex > 0;
+  uint32_t traceHash = 0;
+  sim_noise_model_t* model;
+
+  if (haveTrace) {
+    sim_noise_pad_trace(node_id);
+    traceHash = sim_noise_trace_hash(node->noiseTrace, node->noiseTraceIndex);
+  }
+  model = sim_noise_map_model(path, haveTrace, traceHash);
+  if (model == NULL) {
+    if (haveTrace) {
+      sim_noise_create_model(node_id);
+    }
+    return FALSE;
+  }
+  sim_noise_use(node_id, model);
+  return TRUE;
 }
 
 char sim_noise_gen(uint16_t node_id)__attribute__ ((C, spontaneous))
 {
   int i;
-  int noiseIndex = 0;
   char noise;
-  struct hashtable *pnoiseTable = noiseData[node_id].noiseTable;
-  char *pKey = noiseData[node_id].key;
-  char *fKey = noiseData[node_id].freqKey;
-  double ranNum = RandomUniform();
-  sim_noise_hash_t *noise_hash;
-  noise_hash = (sim_noise_hash_t *)hashtable_search(pnoiseTable, pKey);
-
-  if (noise_hash == NULL) {
+  sim_noise_node_t* node = sim_noise_node(node_id);
+  sim_noise_model_t* model = node->model;
+  char *pKey = node->key;
+  double ranNum = sim_random_uniform(node_id, SIM_RANDOM_NOISE);
+  double scaled;
+  int column;
+  sim_noise_entry_t* entry;
+  int index = sim_noise_lookup(model, pKey, node->keyHash);
+
+  if (index < 0) {
     //Tal Debug
     dbg("Noise_c", "Did not pattern match");
     //End Tal Debug
-    sim_noise_alarm();
-    noise = 0;
     dbg_clear("HASH", "(N)Noise\n");
     dbg("HashZeroDebug", "Defaulting to common hash.\n");
-    memcpy((void *)pKey, (void *)fKey, NOISE_HISTORY);
-    noise_hash = (sim_noise_hash_t *)hashtable_search(pnoiseTable, pKey);
+    index = model->freqEntry;
+    memcpy((void *)pKey, (void *)(model->keys + index * NOISE_HISTORY), NOISE_HISTORY);
+    node->keyHash = sim_noise_hash(pKey);
   }
+  entry = &model->entries[index];
   
   dbg_clear("HASH", "Key = ");
   for (i=0; i< NOISE_HISTORY ; i++) {
@@ -316,14 +770,14 @@ char sim_noise_gen(uint16_t node_id)__attribute__ ((C, spontaneous))
   dbg_clear("HASH", "\n");
   
   dbg("HASH", "Printing Key\n");
-  dbg("HASH", "noise_hash->numElements=%d\n", noise_hash->numElements);
+  dbg("HASH", "entry->numElements=%d\n", entry->numElements);
   
   //Tal Debug
   numTotal++;
   //End Tal Debug
 
-  if (noise_hash->numElements == 1) {
-    noise = noise_hash->elements[0];
+  if (entry->numElements == 1) {
+    noise = entry->single;
     dbg_clear("HASH", "(E)Noise = %d\n", noise);
     //Tal Debug
     numCase1++;
@@ -337,24 +791,22 @@ char sim_noise_gen(uint16_t node_id)__attribute__ ((C, spontaneous))
   numCase2++;
   dbg("Noise_c", "In case 2: %i of %i\n", numCase2, numTotal);
   //End Tal Debug
- 
-  for (i = 0; i < NOISE_NUM_VALUES - 1; i++) {
-    dbg("HASH", "IN:for i=%d\n", i);
-    if (i == 0) {	
-      if (ranNum <= noise_hash->dist[i]) {
-	noiseIndex = i;
-	dbg_clear("HASH", "Selected Bin = %d -> ", i+1);
-	break;
-      }
-    }
-    else if ( (noise_hash->dist[i-1] < ranNum) && 
-	      (ranNum <= noise_hash->dist[i])   ) {
-      noiseIndex = i;
-      dbg_clear("HASH", "Selected Bin = %d -> ", i+1);
-      break;
-    }
+
+  // The integer part of ranNum * NOISE_NUM_VALUES picks a column of
+  // the alias table and the fraction decides between the column's
+  // own reading and its alias.
+  scaled = ranNum * NOISE_NUM_VALUES;
+  column = (int)scaled;
+  if (column >= NOISE_NUM_VALUES) {
+    column = NOISE_NUM_VALUES - 1;
   }
-  dbg("HASH", "OUT:for i=%d\n", i);
+  if ((uint32_t)((scaled - column) * 65536.0) < entry->prob[column]) {
+    i = column;
+  }
+  else {
+    i = entry->alias[column];
+  }
+  dbg_clear("HASH", "Selected Bin = %d -> ", i+1);
   
   noise = NOISE_MIN_QUANTIZE + i; //TODO search_noise_from_bin_num(i+1);
   dbg("NoiseAudit", "Noise: %i\n", noise);		
@@ -365,21 +817,23 @@ char sim_noise_generate(uint16_t node_id, uint32_t cur_t)__attribute__ ((C, spon
   uint32_t i;
   uint32_t prev_t;
   uint32_t delta_t;
-  char *noiseG;
   char noise;
+  sim_noise_node_t* node = sim_noise_node(node_id);
+  sim_noise_model_t* model = node->model;
 
-  prev_t = noiseData[node_id].noiseGenTime;
+  prev_t = node->noiseGenTime;
 
-  if (noiseData[node_id].generated == 0) {
+  if (node->generated == 0) {
     dbgerror("TOSSIM", "Tried to generate noise from an uninitialized radio model of node %hu.\n", node_id);
     return 127;
   }
   
   if ( (0<= cur_t) && (cur_t < NOISE_HISTORY) ) {
-    noiseData[node_id].noiseGenTime = cur_t;
-    noiseData[node_id].key[cur_t] = search_bin_num(noiseData[node_id].noiseTrace[cur_t]);
-    noiseData[node_id].lastNoiseVal = noiseData[node_id].noiseTrace[cur_t];
-    return noiseData[node_id].noiseTrace[cur_t];
+    node->noiseGenTime = cur_t;
+    node->key[cur_t] = search_bin_num(model->trace[cur_t]);
+    node->keyHash = sim_noise_hash(node->key);
+    node->lastNoiseVal = model->trace[cur_t];
+    return model->trace[cur_t];
   }
 
   if (prev_t == 0)
@@ -390,47 +844,21 @@ char sim_noise_generate(uint16_t node_id, uint32_t cur_t)__attribute__ ((C, spon
   dbg_clear("HASH", "delta_t = %d\n", delta_t);
   
   if (delta_t == 0)
-    noise = noiseData[node_id].lastNoiseVal;
+    noise = node->lastNoiseVal;
   else {
-    noiseG = (char *)malloc(sizeof(char)*delta_t);
-    
+    // Walk the chain forward one reading per millisecond; only the
+    // last reading is returned.
+    noise = 0;
     for(i=0; i< delta_t; i++) {
-      noiseG[i] = sim_noise_gen(node_id);
-      arrangeKey(node_id);
-      noiseData[node_id].key[NOISE_HISTORY-1] = search_bin_num(noiseG[i]);
+      noise = sim_noise_gen(node_id);
+      sim_noise_shift_key(node->key, &node->keyHash, search_bin_num(noise));
     }
-    noise = noiseG[delta_t-1];
-    noiseData[node_id].lastNoiseVal = noise;
-    
-    free(noiseG);
+    node->lastNoiseVal = noise;
   }
-  noiseData[node_id].noiseGenTime = cur_t;
+  sim_noise_node(node_id)->noiseGenTime = cur_t;
   if (noise == 0) {
     dbg("HashZeroDebug", "Generated noise of zero.\n");
   }
 //  printf("%i\n", noise);
   return noise;
 }
-
-/* 
- * When initialization process is going on, make noise model by putting
- * experimental noise values.
- */
-void makeNoiseModel(uint16_t node_id)__attribute__ ((C, spontaneous)) {
-  int i;
-  for(i=0; i<NOISE_HISTORY; i++) {
-    noiseData[node_id].key[i] = search_bin_num(noiseData[node_id].noiseTrace[i]);
-    dbg("Insert", "Setting history %i to be %i\n", (int)i, (int)noiseData[node_id].key[i]);
-  }
-  
-  //sim_noise_add(node_id, noiseData[node_id].noiseTrace[NOISE_HISTORY]);
-  //arrangeKey(node_id);
-  
-  for(i = NOISE_HISTORY; i < noiseData[node_id].noiseTraceIndex; i++) {
-    sim_noise_add(node_id, noiseData[node_id].noiseTrace[i]);
-    arrangeKey(node_id);
-    noiseData[node_id].key[NOISE_HISTORY-1] = search_bin_num(noiseData[node_id].noiseTrace[i]);
-  }
-  noiseData[node_id].generated = 1;
-}
-
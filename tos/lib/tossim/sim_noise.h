@@ -43,6 +43,7 @@
 #define _SIM_NOISE_HASH_H_
 
 #include <stdio.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -61,22 +62,56 @@ enum {
   NOISE_NUM_VALUES = NOISE_MAX - NOISE_MIN + 1,    //TODO check the + 1, also in NOISE_BIN_SIZE above in the inner parens
 };
   
-typedef struct sim_noise_hash_t {
-  char key[NOISE_HISTORY];
-  int numElements;
-  int size;
-  char *elements;
-  char flag;
-  float dist[NOISE_NUM_VALUES];
-} sim_noise_hash_t;
+/*
+ * A compiled noise model: for every NOISE_HISTORY-long history of
+ * quantized readings seen in a trace, the distribution of the reading
+ * that followed it. A model is immutable once built and is shared by
+ * every node whose trace is identical, so a network where all nodes
+ * read the same trace file builds and stores it once. Each node
+ * keeps only its own history key (sim_noise_node_t).
+ *
+ * A model can be written to a binary file and mapped back in with
+ * sim_noise_save_model() and sim_noise_load_model(), which skips
+ * both reading the trace and compiling it. The file is in host byte
+ * order and is only meant to be reused on the same kind of machine.
+ */
+typedef struct sim_noise_entry {
+  int numElements;      // Number of readings that followed this history
+  char single;          // The reading, when numElements == 1
+  // Alias table over readings: column i yields reading i with
+  // probability prob[i] / 65536 and reading alias[i] otherwise.
+  uint8_t alias[NOISE_NUM_VALUES];
+  uint16_t prob[NOISE_NUM_VALUES];
+} sim_noise_entry_t;
+
+typedef struct sim_noise_model {
+  int numEntries;
+  int tableSize;        // Power of two
+  int freqEntry;        // Most frequent history, used when one is not found
+  char* keys;           // numEntries histories of NOISE_HISTORY bins
+  sim_noise_entry_t* entries;
+  int* table;           // Open-addressed index into entries, -1 if empty
+
+  char* trace;          // Raw readings; only the first NOISE_HISTORY if loaded
+  uint32_t traceLen;
+  uint32_t traceHash;
+  char initialKey[NOISE_HISTORY]; // History after the last reading
+
+  int refs;             // Nodes using this model
+  void* mapping;        // Non-NULL if loaded from a file
+  size_t mappingLen;
+  unsigned long fileDev;
+  unsigned long fileIno;
+  struct sim_noise_model* next;
+} sim_noise_model_t;
 
 typedef struct sim_noise_node_t {
   char key[NOISE_HISTORY];
-  char freqKey[NOISE_HISTORY];
+  unsigned int keyHash; // Hash of key, kept up to date as it shifts
   char lastNoiseVal;
   uint32_t noiseGenTime;
-  struct hashtable *noiseTable;
-  char* noiseTrace;
+  sim_noise_model_t* model;
+  char* noiseTrace;     // Readings added since the model was last built
   uint32_t noiseTraceLen;
   uint32_t noiseTraceIndex;
   bool generated;
@@ -86,7 +121,11 @@ void sim_noise_init();
 char sim_real_noise(uint16_t node_id, uint32_t cur_t);
 char sim_noise_generate(uint16_t node_id, uint32_t cur_t);
 void sim_noise_trace_add(uint16_t node_id, char val);
+void sim_noise_trace_add_readings(uint16_t node_id, const char* values, uint32_t count);
+int sim_noise_trace_load(uint16_t node_id, const char* path);
 void sim_noise_create_model(uint16_t node_id);
+bool sim_noise_save_model(uint16_t node_id, const char* path);
+bool sim_noise_load_model(uint16_t node_id, const char* path);
   
 #ifdef __cplusplus
 }
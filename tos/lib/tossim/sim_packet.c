@@ -115,7 +115,12 @@ sim_packet_t* sim_packet_allocate () __attribute__ ((C, spontaneous)){
   return (sim_packet_t*)malloc(sizeof(message_t));
 }
 
+sim_packet_t* sim_packet_copy(sim_packet_t* p) __attribute__ ((C, spontaneous)){
+  sim_packet_t* copy = sim_packet_allocate();
+  memcpy(copy, p, sizeof(message_t));
+  return copy;
+}
+
 void sim_packet_free(sim_packet_t* p) __attribute__ ((C, spontaneous)) {
-  printf("sim_packet.c: Freeing packet %p\n", p);
   free(p);
 }
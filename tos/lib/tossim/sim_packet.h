@@ -73,10 +73,13 @@ extern "C" {
   uint8_t* sim_packet_data(sim_packet_t* msg);
   void sim_packet_set_strength(sim_packet_t* msg, uint16_t str);
 
+  // Takes ownership of msg, which must come from sim_packet_allocate()
+  // or sim_packet_copy(); it is freed once delivered.
   void sim_packet_deliver(int node, sim_packet_t* msg, sim_time_t t);
   uint8_t sim_packet_max_length(sim_packet_t* msg);
 
   sim_packet_t* sim_packet_allocate();
+  sim_packet_t* sim_packet_copy(sim_packet_t* m);
   void sim_packet_free(sim_packet_t* m);
 
 #ifdef __cplusplus
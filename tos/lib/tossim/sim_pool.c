@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Implementation of the simulator's free-list allocator. See
+ * sim_pool.h.
+ *
+ * @date   Oct 18 2026
+ */
+
+#include <sim_pool.h>
+
+enum {
+  SIM_POOL_CLASSES = SIM_POOL_MAX_SIZE / SIM_POOL_GRANULE,
+};
+
+static long long int poolAllocations = 0;
+static long long int poolInUse = 0;
+static long long int poolPeak = 0;
+static long long int poolSystemAllocations = 0;
+static long long int poolReserved = 0;
+
+// With TOSSIM_NO_POOL every request goes to malloc() and only the
+// counters remain.
+#ifndef TOSSIM_NO_POOL
+typedef struct sim_pool_object {
+  struct sim_pool_object* next;
+} sim_pool_object_t;
+
+static sim_pool_object_t* poolFree[SIM_POOL_CLASSES];
+
+static inline int sim_pool_class(size_t size) {
+  if (size == 0) {
+    size = 1;
+  }
+  return (int)((size - 1) / SIM_POOL_GRANULE);
+}
+
+// Carve a new chunk into objects of size class c and thread them
+// onto its free list. The chunks themselves are never freed.
+static void sim_pool_refill(int c) {
+  size_t objSize = (size_t)(c + 1) * SIM_POOL_GRANULE;
+  char* chunk = (char*)malloc(objSize * SIM_POOL_CHUNK_OBJECTS);
+  int i;
+
+  if (chunk == NULL) {
+    return;
+  }
+  poolSystemAllocations++;
+  poolReserved += objSize * SIM_POOL_CHUNK_OBJECTS;
+
+  for (i = SIM_POOL_CHUNK_OBJECTS - 1; i >= 0; i--) {
+    sim_pool_object_t* obj = (sim_pool_object_t*)(chunk + i * objSize);
+    obj->next = poolFree[c];
+    poolFree[c] = obj;
+  }
+}
+#endif
+
+void* sim_pool_alloc(size_t size) __attribute__ ((C, spontaneous)) {
+  void* ptr;
+  poolAllocations++;
+
+#ifndef TOSSIM_NO_POOL
+  if (size <= SIM_POOL_MAX_SIZE) {
+    int c = sim_pool_class(size);
+    if (poolFree[c] == NULL) {
+      sim_pool_refill(c);
+    }
+    ptr = poolFree[c];
+    if (ptr != NULL) {
+      poolFree[c] = poolFree[c]->next;
+    }
+  }
+  else
+#endif
+  {
+    poolSystemAllocations++;
+    ptr = malloc(size);
+  }
+
+  if (ptr != NULL) {
+    poolInUse++;
+    if (poolInUse > poolPeak) {
+      poolPeak = poolInUse;
+    }
+  }
+  return ptr;
+}
+
+void sim_pool_free(void* ptr, size_t size) __attribute__ ((C, spontaneous)) {
+  if (ptr == NULL) {
+    return;
+  }
+  poolInUse--;
+
+#ifndef TOSSIM_NO_POOL
+  if (size <= SIM_POOL_MAX_SIZE) {
+    int c = sim_pool_class(size);
+    sim_pool_object_t* obj = (sim_pool_object_t*)ptr;
+    obj->next = poolFree[c];
+    poolFree[c] = obj;
+    return;
+  }
+#else
+  (void)size;
+#endif
+  free(ptr);
+}
+
+long long int sim_pool_allocations() __attribute__ ((C, spontaneous)) {
+  return poolAllocations;
+}
+
+long long int sim_pool_in_use() __attribute__ ((C, spontaneous)) {
+  return poolInUse;
+}
+
+long long int sim_pool_peak_in_use() __attribute__ ((C, spontaneous)) {
+  return poolPeak;
+}
+
+long long int sim_pool_system_allocations() __attribute__ ((C, spontaneous)) {
+  return poolSystemAllocations;
+}
+
+long long int sim_pool_reserved_bytes() __attribute__ ((C, spontaneous)) {
+  return poolReserved;
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Free-list allocator for the small, fixed-size objects the simulator
+ * creates and destroys at a high rate: queue events, radio reception
+ * records and the like. A broadcast in a dense network creates
+ * several of these per receiver, so going through malloc() and
+ * free() for each one is a measurable fraction of simulation time.
+ *
+ * Requests are rounded up to a multiple of SIM_POOL_GRANULE bytes
+ * and served from a per-size free list, which is refilled a chunk of
+ * objects at a time. Memory is never returned to the system; a pool
+ * stays as large as the peak number of objects live at once.
+ * Requests larger than SIM_POOL_MAX_SIZE go straight to malloc().
+ *
+ * Objects must be returned with sim_pool_free() and the same size
+ * they were allocated with. Compiling with -DTOSSIM_NO_POOL turns
+ * the pool into plain malloc() and free(), which is useful when
+ * running under valgrind.
+ *
+ * @date   Oct 18 2026
+ */
+
+#ifndef SIM_POOL_H_INCLUDED
+#define SIM_POOL_H_INCLUDED
+
+#ifndef SIM_POOL_GRANULE
+#define SIM_POOL_GRANULE 16
+#endif
+
+#ifndef SIM_POOL_MAX_SIZE
+#define SIM_POOL_MAX_SIZE 256
+#endif
+
+#ifndef SIM_POOL_CHUNK_OBJECTS
+#define SIM_POOL_CHUNK_OBJECTS 128
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void* sim_pool_alloc(size_t size);
+void sim_pool_free(void* ptr, size_t size);
+
+// Number of sim_pool_alloc() calls so far.
+long long int sim_pool_allocations();
+// Number of objects allocated and not yet freed.
+long long int sim_pool_in_use();
+// Largest value sim_pool_in_use() has reached.
+long long int sim_pool_peak_in_use();
+// Number of times the pool had to call malloc(), whether for a new
+// chunk or for an object too large to pool.
+long long int sim_pool_system_allocations();
+// Bytes held in chunks, whether in use or on a free list.
+long long int sim_pool_reserved_bytes();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_POOL_H_INCLUDED
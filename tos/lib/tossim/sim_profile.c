@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Implementation of the event loop profiler. See sim_profile.h.
+ *
+ * @date   Oct 18 2026
+ */
+
+#include <sim_profile.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <dlfcn.h>
+#define SIM_PROFILE_DLADDR
+#endif
+
+typedef struct sim_profile_entry {
+  void (*handle)(sim_event_t* e);
+  long long int events;
+  long long int tombstones; // popped already cancelled
+  long long int cancelled;  // taken out by sim_queue_cancel()
+  unsigned long long cycles;
+} sim_profile_entry_t;
+
+bool sim_profile_on = FALSE;
+
+// Open addressing on the handler address; a run has a few dozen
+// handlers at most.
+static sim_profile_entry_t* profileTable = NULL;
+static int profileCapacity = 0;
+static int profileUsed = 0;
+static int profileQueueMax = 0;
+
+// Totals while enabled, and where the current enabled span began.
+static unsigned long long profileCycles = 0;
+static double profileWall = 0.0;
+static sim_time_t profileSimTicks = 0;
+static unsigned long long profileStartCycles;
+static struct timespec profileStartWall;
+static sim_time_t profileStartSim;
+
+static char* profileJson = NULL;
+static int profileJsonSize = 0;
+static int profileJsonLen = 0;
+
+unsigned long long sim_profile_cycles() {
+#if defined(__i386__) || defined(__x86_64__)
+  unsigned int lo, hi;
+  __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+  return ((unsigned long long)hi << 32) | lo;
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (unsigned long long)now.tv_sec * 1000000000ULL + now.tv_nsec;
+#endif
+}
+
+static double sim_profile_wall(const struct timespec* start) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static unsigned int sim_profile_hash(void (*handle)(sim_event_t* e)) {
+  uintptr_t val = (uintptr_t)handle;
+  return (unsigned int)((val >> 4) ^ (val >> 16));
+}
+
+static sim_profile_entry_t* sim_profile_entry(void (*handle)(sim_event_t* e)) {
+  unsigned int i;
+  if ((profileUsed + 1) * 2 > profileCapacity) {
+    sim_profile_entry_t* old = profileTable;
+    int oldCapacity = profileCapacity;
+    int j;
+    profileCapacity = (oldCapacity == 0)? 64 : oldCapacity * 2;
+    profileTable = (sim_profile_entry_t*)calloc(profileCapacity, sizeof(sim_profile_entry_t));
+    for (j = 0; j < oldCapacity; j++) {
+      if (old[j].handle != NULL) {
+	i = sim_profile_hash(old[j].handle) & (profileCapacity - 1);
+	while (profileTable[i].handle != NULL) {
+	  i = (i + 1) & (profileCapacity - 1);
+	}
+	profileTable[i] = old[j];
+      }
+    }
+    free(old);
+  }
+  i = sim_profile_hash(handle) & (profileCapacity - 1);
+  while (profileTable[i].handle != handle) {
+    if (profileTable[i].handle == NULL) {
+      profileTable[i].handle = handle;
+      profileUsed++;
+      break;
+    }
+    i = (i + 1) & (profileCapacity - 1);
+  }
+  return &profileTable[i];
+}
+
+void sim_profile_event(void (*handle)(sim_event_t* e), bool cancelled, unsigned long long cycles) {
+  sim_profile_entry_t* entry = sim_profile_entry(handle);
+  int size = sim_queue_size();
+  entry->events++;
+  entry->cycles += cycles;
+  if (cancelled) {
+    entry->tombstones++;
+  }
+  if (size > profileQueueMax) {
+    profileQueueMax = size;
+  }
+}
+
+void sim_profile_cancelled(sim_event_t* event) {
+  if (event->handle != NULL) {
+    sim_profile_entry(event->handle)->cancelled++;
+  }
+}
+
+void sim_profile_enable(bool enable) __attribute__ ((C, spontaneous)) {
+  if (enable && !sim_profile_on) {
+    profileStartCycles = sim_profile_cycles();
+    clock_gettime(CLOCK_MONOTONIC, &profileStartWall);
+    profileStartSim = sim_time();
+  }
+  else if (!enable && sim_profile_on) {
+    profileCycles += sim_profile_cycles() - profileStartCycles;
+    profileWall += sim_profile_wall(&profileStartWall);
+    profileSimTicks += sim_time() - profileStartSim;
+  }
+  sim_profile_on = enable;
+}
+
+bool sim_profile_enabled() __attribute__ ((C, spontaneous)) {
+  return sim_profile_on;
+}
+
+void sim_profile_reset() __attribute__ ((C, spontaneous)) {
+  bool enabled = sim_profile_on;
+  sim_profile_enable(FALSE);
+  free(profileTable);
+  profileTable = NULL;
+  profileCapacity = 0;
+  profileUsed = 0;
+  profileQueueMax = 0;
+  profileCycles = 0;
+  profileWall = 0.0;
+  profileSimTicks = 0;
+  sim_profile_enable(enabled);
+}
+
+static void sim_profile_append(const char* format, ...) {
+  va_list args;
+  int len;
+  for (;;) {
+    va_start(args, format);
+    len = vsnprintf(profileJson + profileJsonLen, profileJsonSize - profileJsonLen, format, args);
+    va_end(args);
+    if (len >= 0 && profileJsonLen + len < profileJsonSize) {
+      profileJsonLen += len;
+      return;
+    }
+    profileJsonSize = (profileJsonSize == 0)? 4096 : profileJsonSize * 2;
+    profileJson = (char*)realloc(profileJson, profileJsonSize);
+  }
+}
+
+// Symbol names may contain nesC's '$' but nothing JSON needs escaped
+// except, conceivably, a quote or backslash.
+static void sim_profile_append_name(void (*handle)(sim_event_t* e)) {
+  const char* name = NULL;
+  const char* c;
+#ifdef SIM_PROFILE_DLADDR
+  Dl_info info;
+  if (dladdr((void*)handle, &info) != 0) {
+    if (info.dli_sname != NULL && info.dli_saddr == (void*)handle) {
+      name = info.dli_sname;
+    }
+    else if (info.dli_fname != NULL) {
+      const char* base = strrchr(info.dli_fname, '/');
+      sim_profile_append("\"%s+0x%lx\"", (base != NULL)? base + 1 : info.dli_fname,
+			 (unsigned long)((uintptr_t)handle - (uintptr_t)info.dli_fbase));
+      return;
+    }
+  }
+#endif
+  if (name == NULL) {
+    sim_profile_append("\"%p\"", (void*)handle);
+    return;
+  }
+  sim_profile_append("\"");
+  for (c = name; *c != 0; c++) {
+    sim_profile_append((*c == '"' || *c == '\\')? "\\%c" : "%c", *c);
+  }
+  sim_profile_append("\"");
+}
+
+static int sim_profile_compare(const void* a, const void* b) {
+  const sim_profile_entry_t* x = *(const sim_profile_entry_t* const*)a;
+  const sim_profile_entry_t* y = *(const sim_profile_entry_t* const*)b;
+  if (x->cycles != y->cycles) {
+    return (x->cycles < y->cycles)? 1 : -1;
+  }
+  return (x->events < y->events) - (x->events > y->events);
+}
+
+char* sim_profile_json() __attribute__ ((C, spontaneous)) {
+  unsigned long long cycles = profileCycles;
+  double wall = profileWall;
+  sim_time_t ticks = profileSimTicks;
+  double simSeconds, cyclesPerSecond;
+  long long int events = 0;
+  sim_profile_entry_t** sorted;
+  int i, count = 0;
+
+  if (sim_profile_on) {
+    cycles += sim_profile_cycles() - profileStartCycles;
+    wall += sim_profile_wall(&profileStartWall);
+    ticks += sim_time() - profileStartSim;
+  }
+  simSeconds = (double)ticks / sim_ticks_per_sec();
+  cyclesPerSecond = (wall > 0.0)? cycles / wall : 0.0;
+
+  sorted = (sim_profile_entry_t**)malloc(sizeof(sim_profile_entry_t*) * (profileUsed + 1));
+  for (i = 0; i < profileCapacity; i++) {
+    if (profileTable[i].handle != NULL) {
+      sorted[count++] = &profileTable[i];
+      events += profileTable[i].events;
+    }
+  }
+  qsort(sorted, count, sizeof(sim_profile_entry_t*), sim_profile_compare);
+
+  profileJsonLen = 0;
+  sim_profile_append("{\"enabled\": %s, \"wall_seconds\": %.6f, \"sim_seconds\": %.6f, "
+		     "\"events\": %lli, \"events_per_sim_second\": %.3f, "
+		     "\"queue_high_water\": %i, \"handlers\": [",
+		     sim_profile_on? "true" : "false", wall, simSeconds, events,
+		     (simSeconds > 0.0)? events / simSeconds : 0.0, profileQueueMax);
+  for (i = 0; i < count; i++) {
+    sim_profile_entry_t* e = sorted[i];
+    double seconds = (cyclesPerSecond > 0.0)? e->cycles / cyclesPerSecond : 0.0;
+    long long int scheduled = e->events + e->cancelled;
+    sim_profile_append("%s\n  {\"handler\": ", (i == 0)? "" : ",");
+    sim_profile_append_name(e->handle);
+    sim_profile_append(", \"events\": %lli, \"seconds\": %.6f, \"mean_ns\": %.1f, "
+		       "\"events_per_sim_second\": %.3f, \"cancelled\": %lli, "
+		       "\"tombstones\": %lli, \"cancelled_ratio\": %.6f}",
+		       e->events, seconds, (e->events > 0)? seconds * 1e9 / e->events : 0.0,
+		       (simSeconds > 0.0)? e->events / simSeconds : 0.0,
+		       e->cancelled, e->tombstones,
+		       (scheduled > 0)? (double)(e->cancelled + e->tombstones) / scheduled : 0.0);
+  }
+  sim_profile_append("]}\n");
+  free(sorted);
+  return profileJson;
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Event loop profiler. While it is enabled, sim_run_next_event()
+ * times every handler it calls with the CPU's cycle counter (rdtsc
+ * on x86, CLOCK_MONOTONIC elsewhere) and keeps, per handler
+ * function: how many events it handled, the time they took, and how
+ * many of its events were cancelled, either removed from the queue
+ * or popped already marked cancelled. It also keeps the largest
+ * queue size seen after an event.
+ *
+ * sim_profile_json() reports these as a JSON object, with handlers
+ * named by dladdr() where the handler is an exported symbol. nesC
+ * makes most module functions static, so handlers are usually
+ * reported as object+offset, which addr2line resolves against the
+ * -g build TOSSIM uses.
+ *
+ * Disabled, the profiler costs one test per event.
+ *
+ * @date   Oct 18 2026
+ */
+
+#ifndef SIM_PROFILE_H_INCLUDED
+#define SIM_PROFILE_H_INCLUDED
+
+#include <sim_event_queue.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void sim_profile_enable(bool enable);
+bool sim_profile_enabled();
+void sim_profile_reset();
+// The JSON report; the string is owned by the profiler and valid
+// until the next call.
+char* sim_profile_json();
+
+// Called by the event loop and queue.
+extern bool sim_profile_on;
+unsigned long long sim_profile_cycles();
+void sim_profile_event(void (*handle)(sim_event_t* e), bool cancelled, unsigned long long cycles);
+void sim_profile_cancelled(sim_event_t* event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_PROFILE_H_INCLUDED
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Packet reception ratio as a function of SNR, for the CPM radio
+ * model.
+ *
+ * The curve is the chip error model CpmModelC has always used:
+ *
+ *   PSE = 0.5 * erfc(beta1 * (SNR - beta2) / sqrt(2))
+ *   PRR = (1 - PSE) ^ length
+ *
+ * where length is the number of symbols the curve was fitted over.
+ * The default parameters are the CC2420 fit by Kannan (beta1 0.9794,
+ * beta2 2.3851, length 46). sim_prr_set_curve() replaces them, for
+ * a radio whose measured curve differs.
+ *
+ * sim_prr_from_snr() looks the curve up in a table with
+ * SIM_PRR_STEPS_PER_DB entries per dB over [SIM_PRR_SNR_MIN,
+ * SIM_PRR_SNR_MAX], interpolating linearly between them; SNRs
+ * outside the range get the value at the nearest end. The table is
+ * filled in the first time it is used after the curve changes.
+ * sim_prr_analytic() evaluates the curve directly.
+ *
+ * @date   Oct 18 2026
+ */
+
+#ifndef SIM_PRR_H_INCLUDED
+#define SIM_PRR_H_INCLUDED
+
+#define SIM_PRR_SNR_MIN (-20)
+#define SIM_PRR_SNR_MAX 30
+#define SIM_PRR_STEPS_PER_DB 100
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void sim_prr_set_curve(double beta1, double beta2, int length);
+double sim_prr_from_snr(double snr);
+double sim_prr_analytic(double snr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_PRR_H_INCLUDED
@@ -43,31 +43,53 @@
 #include <sim_tossim.h>
 #include <sim_event_queue.h>
 #include <sim_mote.h>
+#include <sim_profile.h>
 #include <stdlib.h>
 #include <sys/time.h>
+#include <time.h>
+#include <errno.h>
+#include <unistd.h>
 
 #include <sim_noise.h> //added by HyungJune Lee
+#include <sim_gain.h>
 
 static sim_time_t sim_ticks;
-static unsigned long current_node;
-static int sim_seed;
+// Exported so nido can index module variables with it directly
+// (-fnesc-nido-motenumber=sim_current_node) rather than calling
+// sim_node() on every access. Only sim_set_node() should write it.
+unsigned long sim_current_node;
+static int sim_nodes = TOSSIM_MAX_NODES;
+static void (*sim_poll_hook)() = NULL;
+
+// Real-time pacing (see sim_set_pace()).
+static double sim_pace_speed = 0.0;
+static sim_time_t sim_pace_quantum;
+static sim_time_t sim_pace_next;
+static sim_time_t sim_pace_sim_start;
+static struct timespec sim_pace_wall_start;
+static long long int sim_pace_sleeps;
+static double sim_pace_slept;
+static double sim_pace_lag;
+static double sim_pace_max_lag;
 
 static int __nesc_nido_resolve(int mote, char* varname, uintptr_t* addr, size_t* size);
+static void sim_random_init(int nodes);
 
 void sim_init() __attribute__ ((C, spontaneous)) {
   sim_queue_init();
   sim_log_init();
   sim_log_commit_change();
+  sim_gain_init(sim_nodes);
   sim_noise_init(); //added by HyungJune Lee
+  sim_random_init(sim_nodes);
 
   {
     struct timeval tv;
     gettimeofday(&tv, NULL);
     // Need to make sure we don't pass zero to seed simulation.
     // But in case some weird timing factor causes usec to always
-    // be zero, default to tv_sec. Note that the explicit
-    // seeding call also has a check for zero. Thanks to Konrad
-    // Iwanicki for finding this. -pal
+    // be zero, default to tv_sec. Thanks to Konrad Iwanicki for
+    // finding this. -pal
     if (tv.tv_usec != 0) {
       sim_random_seed(tv.tv_usec);
     }
@@ -83,28 +105,81 @@ void sim_end() __attribute__ ((C, spontaneous)) {
 
 
 
+// Random numbers come from counter-based streams, one per node and
+// purpose (SIM_RANDOM_*): draw n of a stream is SplitMix64's output
+// function applied to key + n * gamma, where the key is a hash of
+// (seed, node, stream). So a stream's draws do not depend on how
+// often any other node or purpose has drawn, and reordering events
+// across nodes leaves each node's sequence alone. Each stream keeps
+// key + n * gamma itself, so a draw is an add and the mix.
+//
+// The table has a row per node sim_init() sized the simulation for,
+// and one more for draws on behalf of no node in range (such as the
+// broadcast address, or sim_current_node outside any event), so
+// that those never advance a real node's streams. Until sim_init()
+// there is only that row.
+#define SIM_RANDOM_GAMMA 0x9e3779b97f4a7c15ULL
+
+static unsigned long long sim_random_none[SIM_RANDOM_STREAMS];
+static unsigned long long (*sim_random_streams)[SIM_RANDOM_STREAMS] = &sim_random_none;
+static int sim_random_nodes = 0;
+static unsigned long long sim_random_key;
+
+static inline unsigned long long sim_random_mix(unsigned long long z) {
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+unsigned long long sim_random_bits(unsigned long node, int stream) __attribute__ ((C, spontaneous)) {
+  if (node >= (unsigned long)sim_random_nodes) {
+    node = sim_random_nodes;
+  }
+  return sim_random_mix(sim_random_streams[node][stream] += SIM_RANDOM_GAMMA);
+}
+
+// Uniform on [0, 1), with 53 random bits.
+double sim_random_uniform(unsigned long node, int stream) __attribute__ ((C, spontaneous)) {
+  return (sim_random_bits(node, stream) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// The current node's SIM_RANDOM_APP stream, as a non-negative int.
 int sim_random() __attribute__ ((C, spontaneous)) {
-  uint32_t mlcg,p,q;
-  uint64_t tmpseed;
-  tmpseed =  (uint64_t)33614U * (uint64_t)sim_seed;
-  q = tmpseed;    /* low */
-  q = q >> 1;
-  p = tmpseed >> 32 ;             /* hi */
-  mlcg = p + q;
-  if (mlcg & 0x80000000) {
-    mlcg = mlcg & 0x7FFFFFFF;
-    mlcg++;
+  return (int)(sim_random_bits(sim_current_node, SIM_RANDOM_APP) >> 33);
+}
+
+// Restarts every stream. The out-of-range row is keyed as node
+// TOSSIM_MAX_NODES, so a node's streams for a seed are the same
+// whatever capacity the simulation was given.
+static void sim_random_fill() {
+  int node, stream;
+  for (node = 0; node <= sim_random_nodes; node++) {
+    unsigned long long key = (node < sim_random_nodes) ? node : TOSSIM_MAX_NODES;
+    key = sim_random_key + key * SIM_RANDOM_STREAMS * SIM_RANDOM_GAMMA;
+    for (stream = 0; stream < SIM_RANDOM_STREAMS; stream++) {
+      key += SIM_RANDOM_GAMMA;
+      sim_random_streams[node][stream] = sim_random_mix(key);
+    }
   }
-  sim_seed = mlcg;
-  return mlcg;
 }
 
 void sim_random_seed(int seed) __attribute__ ((C, spontaneous)) {
-  // A seed of zero wedges on zero, so use 1 instead.
-  if (seed == 0) {
-    seed = 1;
+  sim_random_key = sim_random_mix((unsigned int)seed);
+  sim_random_fill();
+}
+
+// Sizes the table for nodes nodes, restarting the streams under the
+// current seed if that changes it.
+static void sim_random_init(int nodes) {
+  if (nodes == sim_random_nodes) {
+    return;
   }
-  sim_seed = seed;
+  if (sim_random_streams == &sim_random_none) {
+    sim_random_streams = NULL;
+  }
+  sim_random_streams = realloc(sim_random_streams, sizeof(sim_random_none) * (nodes + 1));
+  sim_random_nodes = nodes;
+  sim_random_fill();
 }
 
 sim_time_t sim_time() __attribute__ ((C, spontaneous)) {
@@ -118,18 +193,108 @@ sim_time_t sim_ticks_per_sec() __attribute__ ((C, spontaneous)) {
   return 10000000000ULL;
 }
 
+// The number of nodes the C-side state (links, noise floors, noise
+// models) is sized for; takes effect at the next sim_init(). nido
+// sizes nesC module variables for TOSSIM_MAX_NODES at compile time,
+// so this can lower the bound but not raise it past that.
+void sim_set_max_nodes(int nodes) __attribute__ ((C, spontaneous)) {
+  if (nodes < 1) {
+    nodes = 1;
+  }
+  if (nodes > TOSSIM_MAX_NODES) {
+    nodes = TOSSIM_MAX_NODES;
+  }
+  sim_nodes = nodes;
+}
+
+int sim_max_nodes() __attribute__ ((C, spontaneous)) {
+  return sim_nodes;
+}
+
 unsigned long sim_node() __attribute__ ((C, spontaneous)) {
-  return current_node;
+  return sim_current_node;
 }
 void sim_set_node(unsigned long node) __attribute__ ((C, spontaneous)) {
-  current_node = node;
+  sim_current_node = node;
   TOS_NODE_ID = node;
 }
 
+static double sim_pace_seconds(const struct timespec* t) {
+  return (t->tv_sec - sim_pace_wall_start.tv_sec) +
+    (t->tv_nsec - sim_pace_wall_start.tv_nsec) / 1e9;
+}
+
+// Hold the simulation until wall-clock time catches up with
+// simulated time t, or note how far behind it is.
+static void sim_pace_wait(sim_time_t t) {
+  struct timespec now, target;
+  double offset = (t - sim_pace_sim_start) / (sim_ticks_per_sec() * sim_pace_speed);
+  double ahead;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  ahead = offset - sim_pace_seconds(&now);
+  sim_pace_next = t + sim_pace_quantum;
+  if (ahead <= 0) {
+    sim_pace_lag = -ahead;
+    if (sim_pace_lag > sim_pace_max_lag) {
+      sim_pace_max_lag = sim_pace_lag;
+    }
+    return;
+  }
+  sim_pace_lag = 0;
+  target.tv_sec = sim_pace_wall_start.tv_sec + (time_t)offset;
+  target.tv_nsec = sim_pace_wall_start.tv_nsec + (long)((offset - (time_t)offset) * 1e9);
+  if (target.tv_nsec >= 1000000000) {
+    target.tv_sec++;
+    target.tv_nsec -= 1000000000;
+  }
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, NULL) == EINTR) {}
+  sim_pace_sleeps++;
+  sim_pace_slept += ahead;
+}
+
+// Run no faster than speed times real time (1.0 is real time; 0
+// turns pacing off). Wall-clock time is only read when an event is
+// at least quantum ticks past the last check, so the simulation can
+// run ahead by up to one quantum; each check sleeps until wall-clock
+// time has caught up. Starting to pace, or changing the speed,
+// resets the statistics.
+void sim_set_pace(double speed, sim_time_t quantum) __attribute__ ((C, spontaneous)) {
+  sim_pace_speed = (speed > 0)? speed : 0.0;
+  sim_pace_quantum = (quantum > 0)? quantum : 1;
+  sim_pace_sim_start = sim_time();
+  sim_pace_next = sim_pace_sim_start;
+  clock_gettime(CLOCK_MONOTONIC, &sim_pace_wall_start);
+  sim_pace_sleeps = 0;
+  sim_pace_slept = 0;
+  sim_pace_lag = 0;
+  sim_pace_max_lag = 0;
+}
+
+long long int sim_pace_sleep_count() __attribute__ ((C, spontaneous)) {
+  return sim_pace_sleeps;
+}
+
+double sim_pace_sleep_time() __attribute__ ((C, spontaneous)) {
+  return sim_pace_slept;
+}
+
+double sim_pace_lag_time() __attribute__ ((C, spontaneous)) {
+  return sim_pace_lag;
+}
+
+double sim_pace_max_lag_time() __attribute__ ((C, spontaneous)) {
+  return sim_pace_max_lag;
+}
+
 bool sim_run_next_event() __attribute__ ((C, spontaneous)) {
   bool result = FALSE;
   if (!sim_queue_is_empty()) {
-    sim_event_t* event = sim_queue_pop();
+    sim_event_t* event;
+    if (sim_pace_speed > 0 && sim_queue_peek_time() >= sim_pace_next) {
+      sim_pace_wait(sim_queue_peek_time());
+    }
+    event = sim_queue_pop();
     sim_set_time(event->time);
     sim_set_node(event->mote);
 
@@ -140,7 +305,17 @@ bool sim_run_next_event() __attribute__ ((C, spontaneous)) {
 	event->handle != NULL) {
       result = TRUE;
       dbg_clear("Tossim", " mote is on (or forced event), run it.\n");
-      event->handle(event);
+      if (sim_profile_on) {
+	// The handler may reschedule the event with another handler.
+	void (*handle)(sim_event_t* e) = event->handle;
+	bool cancelled = event->cancelled;
+	unsigned long long start = sim_profile_cycles();
+	handle(event);
+	sim_profile_event(handle, cancelled, sim_profile_cycles() - start);
+      }
+      else {
+	event->handle(event);
+      }
     }
     else {
       dbg_clear("Tossim", "\n");
@@ -148,11 +323,76 @@ bool sim_run_next_event() __attribute__ ((C, spontaneous)) {
     if (event->cleanup != NULL) {
       event->cleanup(event);
     }
+    if (sim_poll_hook != NULL) {
+      sim_poll_hook();
+    }
   }
 
   return result;
 }
 
+// Called after every event, so I/O such as the serial forwarder is
+// serviced by the native run loops without a call per event from the
+// script. The hook must be cheap when it has nothing to do.
+void sim_set_poll_hook(void (*hook)()) __attribute__ ((C, spontaneous)) {
+  sim_poll_hook = hook;
+}
+
+/* Run every event scheduled at or before endTime, then advance the
+   clock to endTime. Returns the number of events popped. */
+long long int sim_run_until(sim_time_t endTime) __attribute__ ((C, spontaneous)) {
+  long long int count = 0;
+  while (!sim_queue_is_empty() && sim_queue_peek_time() <= endTime) {
+    sim_run_next_event();
+    count++;
+  }
+  if (sim_pace_speed > 0 && endTime >= sim_pace_next) {
+    sim_pace_wait(endTime);
+  }
+  if (sim_time() < endTime) {
+    sim_set_time(endTime);
+  }
+  sim_log_flush();
+  return count;
+}
+
+/* Run up to count events. Returns the number of events popped, which
+   is less than count only if the queue empties. */
+long long int sim_run_events(long long int count) __attribute__ ((C, spontaneous)) {
+  long long int i;
+  for (i = 0; i < count && !sim_queue_is_empty(); i++) {
+    sim_run_next_event();
+  }
+  sim_log_flush();
+  return i;
+}
+
+// Split the simulation in two: the child carries on from this point
+// with its own copy of every node, event, link and noise model. Both
+// processes share open files, so buffered output is flushed first so
+// that it is not written twice, and the child drops the binary trace
+// rather than interleave records into the parent's file. Returns
+// what fork() does.
+int sim_fork() __attribute__ ((C, spontaneous)) {
+  int pid;
+  sim_log_flush();
+  fflush(NULL);
+  pid = fork();
+  if (pid == 0) {
+    sim_log_close_trace();
+  }
+  return pid;
+}
+
+// Leave a branch started by sim_fork(). _exit() rather than exit(),
+// so the child does not run the parent's atexit handlers or flush
+// stdio buffers a second time; output of its own is flushed here.
+void sim_end_branch(int status) __attribute__ ((C, spontaneous)) {
+  sim_log_flush();
+  fflush(NULL);
+  _exit(status);
+}
+
 int sim_print_time(char* buf, int len, sim_time_t ftime) __attribute__ ((C, spontaneous)) {
   int hours;
   int minutes;
@@ -193,3 +433,23 @@ void sim_add_channel(char* channel, FILE* file) __attribute__ ((C, spontaneous))
 bool sim_remove_channel(char* channel, FILE* file)  __attribute__ ((C, spontaneous)) {
   return sim_log_remove_channel(channel, file);
 }
+
+void sim_flush_channels() __attribute__ ((C, spontaneous)) {
+  sim_log_flush();
+}
+
+bool sim_open_trace(char* path) __attribute__ ((C, spontaneous)) {
+  return sim_log_open_trace(path);
+}
+
+void sim_close_trace() __attribute__ ((C, spontaneous)) {
+  sim_log_close_trace();
+}
+
+void sim_add_trace_channel(char* channel) __attribute__ ((C, spontaneous)) {
+  sim_log_add_trace_channel(channel);
+}
+
+bool sim_remove_trace_channel(char* channel) __attribute__ ((C, spontaneous)) {
+  return sim_log_remove_trace_channel(channel);
+}
@@ -54,13 +54,29 @@ void sim_init();
 void sim_start();
 void sim_end();
 
+// Independent random streams: each node has one of each, so draws
+// for one purpose never shift the numbers another one sees.
+enum {
+  SIM_RANDOM_APP = 0,   // sim_random(): application code, CSMA backoff
+  SIM_RANDOM_RADIO = 1, // RandomUniform(): packet reception
+  SIM_RANDOM_NOISE = 2, // noise trace generation
+  SIM_RANDOM_GAIN = 3,  // sim_gain_sample_noise()
+  SIM_RANDOM_STREAMS = 4
+};
+
 void sim_random_seed(int seed);
 int sim_random();
+unsigned long long sim_random_bits(unsigned long node, int stream);
+double sim_random_uniform(unsigned long node, int stream);
   
 sim_time_t sim_time();
 void sim_set_time(sim_time_t time);
 sim_time_t sim_ticks_per_sec();
   
+void sim_set_max_nodes(int nodes);
+int sim_max_nodes();
+
+extern unsigned long sim_current_node;
 unsigned long sim_node();
 void sim_set_node(unsigned long node);
 
@@ -70,8 +86,25 @@ char* sim_time_string();
 
 void sim_add_channel(char* channel, FILE* file);
 bool sim_remove_channel(char* channel, FILE* file);
+void sim_flush_channels();
+
+bool sim_open_trace(char* path);
+void sim_close_trace();
+void sim_add_trace_channel(char* channel);
+bool sim_remove_trace_channel(char* channel);
   
 bool sim_run_next_event();
+void sim_set_pace(double speed, sim_time_t quantum);
+long long int sim_pace_sleep_count();
+double sim_pace_sleep_time();
+double sim_pace_lag_time();
+double sim_pace_max_lag_time();
+void sim_set_poll_hook(void (*hook)());
+long long int sim_run_until(sim_time_t endTime);
+long long int sim_run_events(long long int count);
+
+int sim_fork();
+void sim_end_branch(int status);
 
   
 #ifdef __cplusplus
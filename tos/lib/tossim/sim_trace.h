@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * The format of TOSSIM binary debug traces. Rather than formatting
+ * the output of a debug statement, a trace records the debug point,
+ * the node, the simulation time and the raw arguments; print-trace
+ * (in trace/) formats them offline. All values are in the byte order
+ * of the machine that wrote the trace.
+ *
+ * A trace starts with the 8 bytes of SIM_TRACE_MAGIC, a uint32_t
+ * version and an int64_t giving sim_ticks_per_sec(). Then follow
+ * records, each starting with a uint8_t type:
+ *
+ *   SIM_TRACE_DEFINE: uint16_t id, uint8_t kind, then the channel
+ *     string and the format string. It precedes the first record of
+ *     each debug point.
+ *   SIM_TRACE_RECORD: uint16_t id, uint32_t node, int64_t time, then
+ *     the arguments of each conversion in the format: an int64_t for
+ *     each '*' width or precision, then an int64_t for integers
+ *     (already narrowed as the length modifier requires), a double
+ *     for floating point, a string for %s and a uint64_t for %p.
+ *
+ * Strings are a uint32_t length followed by that many bytes, with a
+ * length of SIM_TRACE_NULL_STRING for a NULL pointer.
+ *
+ * @date   Oct 18 2026
+ */
+
+#ifndef SIM_TRACE_H_INCLUDED
+#define SIM_TRACE_H_INCLUDED
+
+#include <string.h>
+
+#define SIM_TRACE_MAGIC "TOSSIMTR"
+#define SIM_TRACE_VERSION 1
+#define SIM_TRACE_NULL_STRING 0xffffffff
+
+enum {
+  SIM_TRACE_DEFINE = 1,
+  SIM_TRACE_RECORD = 2,
+};
+
+// Which of the dbg() macros a debug point is
+enum {
+  SIM_TRACE_DEBUG = 0,
+  SIM_TRACE_DEBUG_CLEAR = 1,
+  SIM_TRACE_ERROR = 2,
+  SIM_TRACE_ERROR_CLEAR = 3,
+};
+
+typedef enum {
+  SIM_TRACE_ARG_NONE = 0,    // %%, %n and unknown conversions
+  SIM_TRACE_ARG_SIGNED = 1,
+  SIM_TRACE_ARG_UNSIGNED = 2,
+  SIM_TRACE_ARG_DOUBLE = 3,
+  SIM_TRACE_ARG_STRING = 4,
+  SIM_TRACE_ARG_POINTER = 5,
+} sim_trace_arg_t;
+
+typedef struct sim_trace_conversion {
+  const char* start;       // The '%'
+  const char* end;         // Just past the conversion character
+  const char* modifier;    // The length modifier, if any
+  int modifierLength;
+  char conversion;
+  int stars;               // Number of '*' width/precision arguments
+  sim_trace_arg_t arg;
+} sim_trace_conversion_t;
+
+/* Find the next conversion specification in format, and fill in c.
+   Returns 0 if there are no more. */
+static int sim_trace_next_conversion(const char* format, sim_trace_conversion_t* c) {
+  const char* p = strchr(format, '%');
+  if (p == NULL) {
+    return 0;
+  }
+  c->start = p++;
+  c->stars = 0;
+  while (*p != 0 && strchr("#0- +'", *p) != NULL) {
+    p++;
+  }
+  while ((*p >= '0' && *p <= '9') || *p == '.' || *p == '*') {
+    if (*p == '*') {
+      c->stars++;
+    }
+    p++;
+  }
+  c->modifier = p;
+  while (*p != 0 && strchr("hlLqjzt", *p) != NULL) {
+    p++;
+  }
+  c->modifierLength = p - c->modifier;
+  c->conversion = *p;
+  c->end = (*p == 0)? p : p + 1;
+  switch (c->conversion) {
+  case 'd': case 'i': case 'c':
+    c->arg = SIM_TRACE_ARG_SIGNED;
+    break;
+  case 'o': case 'u': case 'x': case 'X':
+    c->arg = SIM_TRACE_ARG_UNSIGNED;
+    break;
+  case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+    c->arg = SIM_TRACE_ARG_DOUBLE;
+    break;
+  case 's':
+    c->arg = SIM_TRACE_ARG_STRING;
+    break;
+  case 'p':
+    c->arg = SIM_TRACE_ARG_POINTER;
+    break;
+  default:
+    c->arg = SIM_TRACE_ARG_NONE;
+    break;
+  }
+  return 1;
+}
+
+#endif // SIM_TRACE_H_INCLUDED
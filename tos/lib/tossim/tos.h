@@ -83,6 +83,7 @@ extern uint16_t TOS_NODE_ID;
 #define TOSSIM_MAX_NODES 1000
 #endif
 
+#include <sim_pool.h>
 #include <sim_event_queue.h>
 #include <sim_tossim.h>
 #include <sim_mote.h>
@@ -99,9 +100,12 @@ struct @atleastonce { };
 struct @exactlyonce { };
 
 #include <sim_log.c>
+#include <sim_pool.c>
 #include <heap.c>
+#include <calendar.c>
 #include <sim_event_queue.c>
 #include <sim_tossim.c>
+#include <sim_profile.c>
 #include <sim_mac.c>
 #include <sim_packet.c>
 #endif
@@ -57,6 +57,11 @@ typedef struct variable_string {
   int isArray;
 } variable_string_t;
 
+typedef struct variable_buffer {
+  char* ptr;
+  int len;
+} variable_buffer_t;
+
 typedef struct nesc_app {
   int numVariables;
   char** variableNames;
@@ -82,6 +87,34 @@ class Variable {
   variable_string_t str;
 };
 
+// A variable on every mote at once. nido keeps each module variable
+// as one array with an entry per mote, so the watch resolves where
+// mote 0's and mote 1's entries are once and can then hand out the
+// whole array in place.
+class Watch {
+ public:
+  Watch(char* name, char* format, int array, int motes);
+  ~Watch();
+
+  bool valid();
+  int motes();
+  int size();
+  int stride();
+  char* type();
+  bool isArray();
+  variable_string_t getData(int mote);
+  variable_buffer_t buffer();
+
+ private:
+  char* realName;
+  char* format;
+  int array;
+  int numMotes;
+  char* base;
+  size_t len;
+  ptrdiff_t step;
+};
+
 class Mote {
  public:
   Mote(nesc_app_t* app);
@@ -101,8 +134,12 @@ class Mote {
   void setID(unsigned long id);  
 
   void addNoiseTraceReading(int val);
+  void addNoiseTraceReadings(const char* readings, int count);
+  int loadNoiseTrace(char* path);
   void createNoiseModel();
   int generateNoise(int when);
+  bool saveNoiseModel(char* file);
+  bool loadNoiseModel(char* file);
   
   Variable* getVariable(char* name);
   
@@ -114,10 +151,12 @@ class Mote {
 
 class Tossim {
  public:
-  Tossim(nesc_app_t* app);
+  Tossim(nesc_app_t* app, int maxNodes = TOSSIM_MAX_NODES);
   ~Tossim();
   
   void init();
+  int maxNodes();
+  void setMaxNodes(int nodes);
   
   long long int time();
   long long int ticksPerSecond();
@@ -127,13 +166,46 @@ class Tossim {
   Mote* currentNode();
   Mote* getNode(unsigned long nodeID);
   void setCurrentNode(unsigned long nodeID);
+  void bootAtTimes(const long long int* times, int count);
 
   void addChannel(char* channel, FILE* file);
   bool removeChannel(char* channel, FILE* file);
+  bool openTrace(char* path);
+  void closeTrace();
+  void addTraceChannel(char* channel);
+  bool removeTraceChannel(char* channel);
   void randomSeed(int seed);
   
   bool runNextEvent();
-
+  long long int runUntil(long long int time);
+  long long int runFor(long long int ticks);
+  long long int runEvents(long long int count);
+
+  void setPace(double speed, long long int quantum);
+  long long int paceSleeps();
+  double paceSleepTime();
+  double paceLag();
+  double paceMaxLag();
+
+  int fork();
+  void endBranch(int status);
+
+  int queueSize();
+  long long int queueRemovedCount();
+  long long int queueTombstoneCount();
+
+  long long int poolAllocations();
+  long long int poolInUse();
+  long long int poolPeakInUse();
+  long long int poolSystemAllocations();
+  long long int poolReservedBytes();
+
+  void setProfiling(bool enable);
+  bool profiling();
+  void resetStats();
+  char* statsJson();
+
+  Watch* watch(char* name);
   MAC* mac();
   Radio* radio();
   Packet* newPacket();
@@ -142,6 +214,10 @@ class Tossim {
   char timeBuf[256];
   nesc_app_t* app;
   Mote** motes;
+  int numNodes;
+  struct hashtable* watchTable;
+  MAC* macModel;
+  Radio* radioModel;
 };
 
 
@@ -263,6 +263,17 @@ PyObject* listFromArray(char* type, char* ptr, int len) {
 }
 
 
+// A read-only buffer over the simulator's memory, not a copy.
+%typemap(python,out) variable_buffer_t {
+  if ($1.ptr == NULL) {
+    Py_INCREF(Py_None);
+    $result = Py_None;
+  }
+  else {
+    $result = PyBuffer_FromMemory($1.ptr, $1.len);
+  }
+}
+
 %typemap(python,in) nesc_app_t* {
   if (!PyList_Check($input)) {
     PyErr_SetString(PyExc_TypeError, "Requires a list as a parameter.");
@@ -322,6 +333,11 @@ typedef struct var_string {
   int isArray;
 } variable_string_t;
 
+typedef struct variable_buffer {
+  char* ptr;
+  int len;
+} variable_buffer_t;
+
 typedef struct nesc_app {
   int numVariables;
   char** variableNames;
@@ -336,6 +352,66 @@ class Variable {
   variable_string_t getData();  
 };
 
+// addNoiseTraceReadings() takes any object exporting a buffer of
+// signed bytes (dBm), such as array.array('b'), a numpy int8 array
+// or a string. The buffer is read in place.
+%typemap(in) (const char* readings, int count) {
+  const void* buf;
+  Py_ssize_t len;
+  if (PyObject_AsReadBuffer($input, &buf, &len) != 0) {
+    return NULL;
+  }
+  $1 = (char*)buf;
+  $2 = (int)len;
+}
+
+class Watch {
+ public:
+  Watch(char* name, char* format, int array, int motes);
+  ~Watch();
+
+  bool valid();
+  int motes();
+  int size();
+  int stride();
+  char* type();
+  bool isArray();
+  variable_string_t getData(int mote);
+  variable_buffer_t buffer();
+};
+
+%extend Watch {
+%pythoncode %{
+    dtypes = {"uint8_t": "u1", "uint16_t": "u2", "uint32_t": "u4",
+              "uint64_t": "u8", "int8_t": "i1", "int16_t": "i2",
+              "int32_t": "i4", "int64_t": "i8", "char": "i1",
+              "unsigned char": "u1", "short": "h", "unsigned short": "H",
+              "int": "i", "unsigned int": "I", "long": "l",
+              "unsigned long": "L", "float": "f4", "double": "f8"}
+    def array(self):
+        """A numpy array over this variable on every mote, in place:
+        row i is mote i's value as the simulation runs, with no copy.
+        Arrays get a column per element and types numpy does not
+        know (structs) a column per byte. Take array().copy() for a
+        snapshot."""
+        view = self.__dict__.get("view")
+        if view is None:
+            import numpy
+            buf = self.buffer()
+            if buf is None:
+                raise KeyError("no such variable")
+            shape = (self.motes(),)
+            strides = (self.stride(),)
+            dtype = numpy.dtype(self.dtypes.get(self.type(), "u1"))
+            if self.isArray() or self.size() != dtype.itemsize:
+                shape += (self.size() // dtype.itemsize,)
+                strides += (dtype.itemsize,)
+            view = numpy.ndarray(shape, dtype, buf, 0, strides)
+            self.__dict__["view"] = view
+        return view
+%}
+}
+
 class Mote {
  public:
   Mote(nesc_app_t* app);
@@ -356,16 +432,54 @@ class Mote {
   Variable* getVariable(char* name);
 
   void addNoiseTraceReading(int val);
+  void addNoiseTraceReadings(const char* readings, int count);
+  int loadNoiseTrace(char* path);
   void createNoiseModel();
   int generateNoise(int when);
+  bool saveNoiseModel(char* file);
+  bool loadNoiseModel(char* file);
 };
 
+%feature("compactdefaultargs") Tossim::Tossim;
+
+// bootAtTimes() takes any object exporting a buffer of 64-bit ints,
+// such as a numpy int64 array, holding each node's boot time. The
+// buffer is read in place.
+%typemap(in) (const long long int* times, int count) {
+  const void* buf;
+  Py_ssize_t len;
+  if (PyObject_AsReadBuffer($input, &buf, &len) != 0) {
+    return NULL;
+  }
+  if (len % sizeof(long long int) != 0) {
+    PyErr_SetString(PyExc_ValueError, "Requires a buffer of 64-bit boot times.");
+    return NULL;
+  }
+  $1 = (long long int*)buf;
+  $2 = (int)(len / sizeof(long long int));
+}
+
+// Packets from newPacket() belong to Python, which frees them.
+%newobject Tossim::newPacket;
+
+// watch() returns NULL if the variable is missing or not laid out as
+// one array across the motes.
+%exception Tossim::watch {
+  $action
+  if (result == NULL) {
+    PyErr_Format(PyExc_KeyError, "Cannot watch %s on every mote.", arg2);
+    SWIG_fail;
+  }
+}
+
 class Tossim {
  public:
-  Tossim(nesc_app_t* app);
+  Tossim(nesc_app_t* app, int maxNodes = TOSSIM_MAX_NODES);
   ~Tossim();
   
   void init();
+  int maxNodes();
+  void setMaxNodes(int nodes);
   
   long long int time();
   long long int ticksPerSecond(); 
@@ -375,15 +489,172 @@ class Tossim {
   Mote* currentNode();
   Mote* getNode(unsigned long nodeID);
   void setCurrentNode(unsigned long nodeID);
+  void bootAtTimes(const long long int* times, int count);
 
   void addChannel(char* channel, FILE* file);
   bool removeChannel(char* channel, FILE* file);
+  bool openTrace(char* path);
+  void closeTrace();
+  void addTraceChannel(char* channel);
+  bool removeTraceChannel(char* channel);
   void randomSeed(int seed);
 
   bool runNextEvent();
+  long long int runUntil(long long int time);
+  long long int runFor(long long int ticks);
+  long long int runEvents(long long int count);
+
+  void setPace(double speed, long long int quantum);
+  long long int paceSleeps();
+  double paceSleepTime();
+  double paceLag();
+  double paceMaxLag();
+
+  int fork();
+  void endBranch(int status);
+
+  int queueSize();
+  long long int queueRemovedCount();
+  long long int queueTombstoneCount();
+
+  long long int poolAllocations();
+  long long int poolInUse();
+  long long int poolPeakInUse();
+  long long int poolSystemAllocations();
+  long long int poolReservedBytes();
+
+  void setProfiling(bool enable);
+  bool profiling();
+  void resetStats();
+  char* statsJson();
+  Watch* watch(char* name);
   MAC* mac();
   Radio* radio();
   Packet* newPacket();
 };
 
+// The event loop runs in C; a hook lets a script service the serial
+// forwarder or a throttle every so often without a Python call per
+// event.
+%extend Tossim {
+%pythoncode %{
+    def setHook(self, hook, period):
+        """Call hook() each time runUntil() or runFor() has advanced
+        simulated time by period ticks. A hook of None removes it."""
+        if hook is not None and period <= 0:
+            raise ValueError("hook period must be positive")
+        self.__dict__["hook"] = hook
+        self.__dict__["hookPeriod"] = period
+        self.__dict__["hookTime"] = self.time() + period
+    def runUntil(self, time):
+        count = 0
+        while self.__dict__.get("hook") is not None and self.hookTime <= time:
+            count += _TOSSIM.Tossim_runUntil(self, self.hookTime)
+            self.__dict__["hookTime"] += self.hookPeriod
+            self.hook()
+        return count + _TOSSIM.Tossim_runUntil(self, time)
+    def runFor(self, ticks):
+        return self.runUntil(self.time() + ticks)
+    def mac(self):
+        m = self.__dict__.get("macModel")
+        if m is None:
+            m = self.__dict__["macModel"] = _TOSSIM.Tossim_mac(self)
+        return m
+    def radio(self):
+        r = self.__dict__.get("radioModel")
+        if r is None:
+            r = self.__dict__["radioModel"] = _TOSSIM.Tossim_radio(self)
+        return r
+    def stats(self):
+        """The event loop profile (see setProfiling()) as a dict:
+        totals, plus a "handlers" list with each event handler's
+        event count, time and cancellations, busiest first. Use
+        statsJson() to save it."""
+        import json
+        return json.loads(self.statsJson())
+    def branch(self, variants):
+        """Run each variant(tossim) in its own fork() of the simulation
+        as it stands now and wait for them all, so one warm-up can
+        feed many experiments. Returns each child's wait status, in
+        order; a variant that raises exits with status 1. Children
+        inherit the random number generator, so a variant should call
+        randomSeed() if the branches are meant to differ."""
+        import os, traceback
+        pids = []
+        for variant in variants:
+            pid = self.fork()
+            if pid < 0:
+                raise OSError("fork failed")
+            if pid == 0:
+                status = 0
+                try:
+                    variant(self)
+                except:
+                    traceback.print_exc()
+                    status = 1
+                self.endBranch(status)
+            pids.append(pid)
+        return [os.waitpid(pid, 0)[1] for pid in pids]
+    def ensemble(self, seeds, run, jobs=None, collect=None):
+        """Run run(tossim, seed) once per seed, each in its own fork()
+        of the simulation as it stands now after randomSeed(seed).
+        Load what the runs share (topology, noise traces and models)
+        and queue the boot events before calling this: the replicas
+        share that memory copy-on-write rather than each loading it.
+        At most jobs replicas (default: one per CPU) run at once.
+        Whatever run() returns is pickled back; collect(seed, result)
+        is called as each replica finishes. Returns the results in
+        seed order, with None for a replica that raised."""
+        import os, pickle, select, traceback
+        if jobs is None:
+            import multiprocessing
+            jobs = multiprocessing.cpu_count()
+        seeds = list(seeds)
+        results = [None] * len(seeds)
+        running = {}
+        chunks = {}
+        nextRun = 0
+        while nextRun < len(seeds) or running:
+            while nextRun < len(seeds) and len(running) < jobs:
+                r, w = os.pipe()
+                pid = self.fork()
+                if pid < 0:
+                    os.close(r)
+                    os.close(w)
+                    raise OSError("fork failed")
+                if pid == 0:
+                    os.close(r)
+                    for fd in running:
+                        os.close(fd)
+                    status = 0
+                    try:
+                        self.randomSeed(seeds[nextRun])
+                        data = pickle.dumps(run(self, seeds[nextRun]), 2)
+                        while data:
+                            data = data[os.write(w, data):]
+                    except:
+                        traceback.print_exc()
+                        status = 1
+                    os.close(w)
+                    self.endBranch(status)
+                os.close(w)
+                running[r] = (pid, nextRun)
+                chunks[r] = []
+                nextRun += 1
+            for fd in select.select(list(running), [], [])[0]:
+                chunk = os.read(fd, 65536)
+                if chunk:
+                    chunks[fd].append(chunk)
+                    continue
+                os.close(fd)
+                pid, index = running.pop(fd)
+                data = b"".join(chunks.pop(fd))
+                if os.waitpid(pid, 0)[1] == 0 and data:
+                    results[index] = pickle.loads(data)
+                if collect is not None:
+                    collect(seeds[index], results[index])
+        return results
+%}
+}
+
 
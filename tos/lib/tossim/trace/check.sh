@@ -0,0 +1,31 @@
+#!/bin/sh
+# Runs print-trace on a small trace and compares its output. The
+# trace is written for a little-endian machine at TOSSIM's 10^10
+# ticks per second, with records at 0.999999999 s and 1.95 s, whose
+# fractions overflow if scaled to nanoseconds by multiplying first.
+
+if [ "`printf '\001\000' | od -An -tu2 | tr -d ' '`" != 1 ]; then
+  echo "check.sh: skipped, the test trace is little-endian"
+  exit 0
+fi
+
+trace=check.trace
+{
+  printf 'TOSSIMTR\001\000\000\000\000\344\013\124\002\000\000\000'
+  # Debug point 0: dbg_clear("Test", "hi\n")
+  printf '\001\000\000\001\004\000\000\000Test\003\000\000\000hi\n'
+  # Node 0 at 9999999999 and node 1 at 19500000000 ticks
+  printf '\002\000\000\000\000\000\000\377\343\013\124\002\000\000\000'
+  printf '\002\000\000\001\000\000\000\000\143\112\212\004\000\000\000'
+} > $trace
+
+expected='0.999999999 hi
+1.950000000 hi'
+actual=`./print-trace -t $trace`
+rm -f $trace
+if [ "$actual" != "$expected" ]; then
+  echo "check.sh: print-trace -t printed:"
+  echo "$actual"
+  exit 1
+fi
+echo "check.sh: OK"
@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2026 The TinyOS contributors. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the
+ *   distribution.
+ * - Neither the name of the copyright holders nor the names of
+ *   its contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL
+ * THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * Formats a TOSSIM binary debug trace (see sim_trace.h) as the text
+ * the same debug statements would have printed to a channel, e.g.:
+ *
+ *   t.openTrace("run.trace")
+ *   t.addTraceChannel("CpmModelC")
+ *
+ *   ./print-trace run.trace
+ *   ./print-trace -t -n 3 -c SNRLoss run.trace
+ *
+ * -t prefixes each line with the simulation time in seconds, -n
+ * prints only the output of one node and -c only debug statements
+ * on a given channel.
+ *
+ * @date   Oct 18 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include <sim_trace.h>
+
+enum {
+  MAX_DEBUG_POINTS = 65536,
+  MAX_SPEC = 64,
+};
+
+typedef struct debug_point {
+  int defined;
+  uint8_t kind;
+  char* channels;
+  char* format;
+} debug_point_t;
+
+static debug_point_t points[MAX_DEBUG_POINTS];
+static FILE* trace;
+
+static int read_value(void* value, size_t size) {
+  return fread(value, size, 1, trace) == 1;
+}
+
+// Returns 0 at the end of the trace; *str is NULL for a NULL string.
+static int read_string(char** str) {
+  uint32_t len;
+  if (!read_value(&len, sizeof(len))) {
+    return 0;
+  }
+  if (len == SIM_TRACE_NULL_STRING) {
+    *str = NULL;
+    return 1;
+  }
+  *str = (char*)malloc(len + 1);
+  if (len > 0 && fread(*str, len, 1, trace) != 1) {
+    free(*str);
+    return 0;
+  }
+  (*str)[len] = 0;
+  return 1;
+}
+
+static int has_channel(const char* channels, const char* channel) {
+  size_t len = strlen(channel);
+  const char* p = channels;
+  while (p != NULL) {
+    if (strncmp(p, channel, len) == 0 && (p[len] == ',' || p[len] == 0)) {
+      return 1;
+    }
+    p = strchr(p, ',');
+    if (p != NULL) {
+      p++;
+    }
+  }
+  return 0;
+}
+
+// Build a printf conversion for a recorded argument: keep the flags,
+// width and precision but replace the length modifier.
+static void make_spec(char* spec, sim_trace_conversion_t* c, const char* modifier, char conversion) {
+  int len = c->modifier - c->start;
+  if (len > MAX_SPEC - 4) {
+    len = MAX_SPEC - 4;
+  }
+  memcpy(spec, c->start, len);
+  spec[len] = 0;
+  strcat(spec, modifier);
+  len = strlen(spec);
+  spec[len] = conversion;
+  spec[len + 1] = 0;
+}
+
+#define PRINT_ARG(spec, value) do {					\
+    if (c.stars == 0) {printf(spec, value);}				\
+    else if (c.stars == 1) {printf(spec, stars[0], value);}		\
+    else {printf(spec, stars[0], stars[1], value);}			\
+  } while (0)
+
+// Print one record, or skip it if print is 0. Returns 0 if the
+// trace ends part way through.
+static int print_record(debug_point_t* point, uint32_t node, int print) {
+  const char* format = point->format;
+  sim_trace_conversion_t c;
+
+  if (print && point->kind == SIM_TRACE_DEBUG) {
+    printf("DEBUG (%i): ", (int)node);
+  }
+  else if (print && point->kind == SIM_TRACE_ERROR) {
+    printf("ERROR (%i): ", (int)node);
+  }
+  while (sim_trace_next_conversion(format, &c)) {
+    char spec[MAX_SPEC];
+    int stars[2] = {0, 0};
+    int64_t value;
+    int i;
+    if (print) {
+      fwrite(format, c.start - format, 1, stdout);
+    }
+    format = c.end;
+    for (i = 0; i < c.stars; i++) {
+      if (!read_value(&value, sizeof(value))) {
+	return 0;
+      }
+      if (i < 2) {
+	stars[i] = (int)value;
+      }
+    }
+    switch (c.arg) {
+    case SIM_TRACE_ARG_SIGNED:
+      if (!read_value(&value, sizeof(value))) {
+	return 0;
+      }
+      if (!print) {}
+      else if (c.conversion == 'c') {
+	make_spec(spec, &c, "", 'c');
+	PRINT_ARG(spec, (int)value);
+      }
+      else {
+	make_spec(spec, &c, "ll", c.conversion);
+	PRINT_ARG(spec, (long long)value);
+      }
+      break;
+    case SIM_TRACE_ARG_UNSIGNED:
+      if (!read_value(&value, sizeof(value))) {
+	return 0;
+      }
+      if (print) {
+	make_spec(spec, &c, "ll", c.conversion);
+	PRINT_ARG(spec, (unsigned long long)value);
+      }
+      break;
+    case SIM_TRACE_ARG_DOUBLE: {
+      double d;
+      if (!read_value(&d, sizeof(d))) {
+	return 0;
+      }
+      if (print) {
+	make_spec(spec, &c, "", c.conversion);
+	PRINT_ARG(spec, d);
+      }
+      break;
+    }
+    case SIM_TRACE_ARG_STRING: {
+      char* str;
+      if (!read_string(&str)) {
+	return 0;
+      }
+      if (print) {
+	make_spec(spec, &c, "", 's');
+	PRINT_ARG(spec, (str == NULL)? "(null)" : str);
+      }
+      free(str);
+      break;
+    }
+    case SIM_TRACE_ARG_POINTER: {
+      uint64_t p;
+      if (!read_value(&p, sizeof(p))) {
+	return 0;
+      }
+      if (print) {
+	make_spec(spec, &c, "", 'p');
+	PRINT_ARG(spec, (void*)(uintptr_t)p);
+      }
+      break;
+    }
+    default:
+      if (print && c.conversion == '%') {
+	putchar('%');
+      }
+      else if (print && c.conversion != 'n') {
+	fwrite(c.start, c.end - c.start, 1, stdout);
+      }
+      break;
+    }
+  }
+  if (print) {
+    fputs(format, stdout);
+  }
+  return 1;
+}
+
+// The nanoseconds past the second at time. TOSSIM runs at 10^10
+// ticks per second, so multiplying the remainder by 10^9 would
+// overflow; divide when the rate is a multiple of 10^9.
+static long long nanoseconds(int64_t time, int64_t ticksPerSec) {
+  int64_t ticks = time % ticksPerSec;
+  if (ticksPerSec % 1000000000LL == 0) {
+    return (long long)(ticks / (ticksPerSec / 1000000000LL));
+  }
+  return (long long)(((long double)ticks * 1000000000.0L) / ticksPerSec);
+}
+
+static void usage(const char* name) {
+  fprintf(stderr, "usage: %s [-t] [-n node] [-c channel] trace\n", name);
+  exit(1);
+}
+
+int main(int argc, char** argv) {
+  char magic[sizeof(SIM_TRACE_MAGIC)];
+  uint32_t version;
+  int64_t ticksPerSec;
+  int showTime = 0;
+  long node = -1;
+  const char* channel = NULL;
+  uint8_t type;
+  int i;
+
+  for (i = 1; i < argc - 1; i++) {
+    if (strcmp(argv[i], "-t") == 0) {showTime = 1;}
+    else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc - 1) {node = atol(argv[++i]);}
+    else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc - 1) {channel = argv[++i];}
+    else {usage(argv[0]);}
+  }
+  if (i != argc - 1) {
+    usage(argv[0]);
+  }
+
+  trace = fopen(argv[argc - 1], "rb");
+  if (trace == NULL) {
+    perror(argv[argc - 1]);
+    return 1;
+  }
+  if (fread(magic, strlen(SIM_TRACE_MAGIC), 1, trace) != 1 ||
+      memcmp(magic, SIM_TRACE_MAGIC, strlen(SIM_TRACE_MAGIC)) != 0 ||
+      !read_value(&version, sizeof(version)) ||
+      !read_value(&ticksPerSec, sizeof(ticksPerSec)) ||
+      ticksPerSec <= 0) {
+    fprintf(stderr, "%s is not a TOSSIM trace.\n", argv[argc - 1]);
+    return 1;
+  }
+  if (version != SIM_TRACE_VERSION) {
+    fprintf(stderr, "%s is trace version %u, but this program reads version %u.\n",
+	    argv[argc - 1], version, SIM_TRACE_VERSION);
+    return 1;
+  }
+
+  while (read_value(&type, sizeof(type))) {
+    uint16_t id;
+    if (!read_value(&id, sizeof(id))) {
+      break;
+    }
+    if (type == SIM_TRACE_DEFINE) {
+      debug_point_t* point = &points[id];
+      free(point->channels);
+      free(point->format);
+      if (!read_value(&point->kind, sizeof(point->kind)) ||
+	  !read_string(&point->channels) ||
+	  !read_string(&point->format)) {
+	break;
+      }
+      point->defined = (point->channels != NULL && point->format != NULL);
+    }
+    else if (type == SIM_TRACE_RECORD) {
+      debug_point_t* point = &points[id];
+      uint32_t recordNode;
+      int64_t time;
+      int print;
+      if (!read_value(&recordNode, sizeof(recordNode)) ||
+	  !read_value(&time, sizeof(time))) {
+	break;
+      }
+      if (!point->defined) {
+	fprintf(stderr, "Record for undefined debug point %u.\n", id);
+	return 1;
+      }
+      print = (node < 0 || node == (long)recordNode) &&
+	(channel == NULL || has_channel(point->channels, channel));
+      if (print && showTime) {
+	printf("%lld.%09lld ", (long long)(time / ticksPerSec),
+	       nanoseconds(time, ticksPerSec));
+      }
+      if (!print_record(point, recordNode, print)) {
+	break;
+      }
+    }
+    else {
+      fprintf(stderr, "Unknown record type %u.\n", type);
+      return 1;
+    }
+  }
+  return 0;
+}
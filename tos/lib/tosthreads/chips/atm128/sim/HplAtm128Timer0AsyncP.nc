@@ -495,8 +495,11 @@ implementation {
 	dbg("HplAtm128Timer0AsyncP", "Setting overflow bit at %s\n", sim_time_string());
 	SET_BIT(ATM128_TIFR, TOV0);
       }
-      configure_overflow(evt);
-      sim_queue_insert(evt);
+      // If we haven't been cancelled
+      if (!evt->cancelled) {
+	configure_overflow(evt);
+	sim_queue_insert(evt);
+      }
     }
   }
   
@@ -547,9 +550,11 @@ implementation {
   
   void cancel_overflow() {
     if (overflow != NULL) {
-      overflow->cancelled = 1;
       dbg("HplAtm128Timer0AsyncP", "Cancelling overflow %p.\n", overflow);
       overflow->cleanup = sim_queue_cleanup_total;
+      // Frees the event if it is still queued.
+      sim_queue_cancel(overflow);
+      overflow = NULL;
     }
   }
 
@@ -580,8 +585,10 @@ implementation {
   void cancel_compare() {
     dbg("HplAtm128CompareC", "Cancelling compare at 0x%p\n", compare);
     if (compare != NULL) {
-      compare->cancelled = 1;
       compare->cleanup = sim_queue_cleanup_total;
+      // Frees the event if it is still queued.
+      sim_queue_cancel(compare);
+      compare = NULL;
     }
   }
 }